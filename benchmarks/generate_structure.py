@@ -0,0 +1,232 @@
+#!/usr/bin/env python3
+"""
+Generate synthetic fiber and woven microstructures for the Macaw benchmarks.
+
+Phase 1 is the gas/matrix and phase 2 the fiber/yarn, as in the EBSD structures of the
+examples. Every fiber or yarn is its own feature. The structure is written in the binary
+microstructure format (read by MicrostructureMeshGenerator/MicrostructureReader) or as an
+ASCII EBSD file (read by EBSDMeshGenerator/EBSDReader).
+
+Layouts:
+  fiber  parallel fibers along x (3D) or fiber cross-sections (2D) on a jittered hexagonal
+         lattice
+  woven  plain weave: in 2D a cross-section of one undulating warp yarn over and under
+         elliptical weft yarns, in 3D warp yarns along x and weft yarns along y with
+         opposite sinusoidal undulation
+
+Examples:
+  python3 generate_structure.py fiber_2d.mcw --layout fiber --dim 2 --nx 256 --ny 256
+  python3 generate_structure.py woven_3d.mcw --layout woven --dim 3 --nx 128 --ny 128 --nz 32
+"""
+
+import argparse
+import array
+import math
+import os
+import random
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'pythonScripts'))
+from ebsd_to_mcw import write_mcw  # noqa: E402
+
+GAS = 1
+FIBER = 2
+
+
+def fiber_layout(args):
+    """Fiber centers (in voxels) in the plane normal to the fiber axis."""
+    rng = random.Random(args.seed)
+    # Cross-section plane is (x, y) in 2D and (y, z) in 3D
+    n0, n1 = (args.nx, args.ny) if args.dim == 2 else (args.ny, args.nz)
+    spacing = args.fiber_spacing
+    row_height = spacing * math.sqrt(3.0) / 2.0
+    centers = []
+    row = 0
+    y = spacing / 2.0
+    while y < n1:
+        x = spacing / 2.0 + (spacing / 2.0 if row % 2 else 0.0)
+        while x < n0:
+            jx = rng.uniform(-args.jitter, args.jitter) * spacing
+            jy = rng.uniform(-args.jitter, args.jitter) * spacing
+            centers.append((x + jx, y + jy))
+            x += spacing
+        y += row_height
+        row += 1
+    return centers
+
+
+def voxelize_fibers(args, phases, features, euler):
+    centers = fiber_layout(args)
+    r2 = args.fiber_radius ** 2
+    n0, n1 = (args.nx, args.ny) if args.dim == 2 else (args.ny, args.nz)
+
+    # Feature id of every voxel of one cross-section
+    section = [0] * (n0 * n1)
+    for f, (c0, c1) in enumerate(centers, start=1):
+        r = args.fiber_radius
+        for j in range(max(int(c1 - r), 0), min(int(c1 + r) + 2, n1)):
+            for i in range(max(int(c0 - r), 0), min(int(c0 + r) + 2, n0)):
+                if (i + 0.5 - c0) ** 2 + (j + 0.5 - c1) ** 2 <= r2:
+                    section[i + n0 * j] = f
+
+    if args.dim == 2:
+        for idx, f in enumerate(section):
+            if f:
+                phases[idx] = FIBER
+                features[idx] = f
+        return
+
+    # 3D: extrude the section along x, fibers point along x (zero Euler angles)
+    for k in range(args.nz):
+        for j in range(args.ny):
+            f = section[j + args.ny * k]
+            if not f:
+                continue
+            base = args.nx * (j + args.ny * k)
+            for i in range(args.nx):
+                phases[base + i] = FIBER
+                features[base + i] = f
+
+
+def voxelize_woven(args, phases, features, euler):
+    p = args.yarn_spacing
+    t = args.yarn_thickness
+    w = args.yarn_width
+    amp = args.undulation * t
+
+    if args.dim == 2:
+        # Section in the (x, y) plane, y is the thickness direction
+        mid = args.ny / 2.0
+        n_weft = int(math.ceil(args.nx / p)) + 1
+        for j in range(args.ny):
+            y = j + 0.5
+            for i in range(args.nx):
+                x = i + 0.5
+                idx = i + args.nx * j
+                # Warp yarn undulating over and under the weft yarns
+                yc = mid + amp * math.cos(math.pi * x / p)
+                if abs(y - yc) <= t / 2.0:
+                    phases[idx] = FIBER
+                    features[idx] = 1
+                    slope = -amp * math.pi / p * math.sin(math.pi * x / p)
+                    euler[3 * idx] = math.degrees(math.atan(slope))
+                    continue
+                # Elliptical weft cross-sections on alternating sides
+                k = int(round(x / p))
+                if 0 <= k < n_weft:
+                    yk = mid - amp * math.cos(math.pi * k)
+                    if ((x - k * p) / (w / 2.0)) ** 2 + ((y - yk) / (t / 2.0)) ** 2 <= 1.0:
+                        phases[idx] = FIBER
+                        features[idx] = 2 + k
+                        euler[3 * idx + 1] = 90.0
+        return
+
+    # 3D: warp yarns along x at y = (m + 1/2) p, weft yarns along y at x = (n + 1/2) p
+    mid = args.nz / 2.0
+    n_warp = int(math.ceil(args.ny / p))
+    for k in range(args.nz):
+        z = k + 0.5
+        for j in range(args.ny):
+            y = j + 0.5
+            m = min(int(y / p), n_warp - 1)
+            for i in range(args.nx):
+                x = i + 0.5
+                n = int(x / p)
+                idx = i + args.nx * (j + args.ny * k)
+                sign_warp = 1.0 if m % 2 == 0 else -1.0
+                zc_warp = mid + sign_warp * amp * math.cos(math.pi * (x / p - 0.5))
+                zc_weft = mid - (1.0 if n % 2 == 0 else -1.0) * amp * math.cos(math.pi * (y / p - 0.5))
+                if abs(y - (m + 0.5) * p) <= w / 2.0 and abs(z - zc_warp) <= t / 2.0:
+                    phases[idx] = FIBER
+                    features[idx] = 1 + m
+                    slope = sign_warp * amp * math.pi / p * math.sin(math.pi * (x / p - 0.5))
+                    euler[3 * idx + 1] = math.degrees(math.atan(slope))
+                elif abs(x - (n + 0.5) * p) <= w / 2.0 and abs(z - zc_weft) <= t / 2.0:
+                    phases[idx] = FIBER
+                    features[idx] = 1 + n_warp + n
+                    euler[3 * idx] = 90.0
+
+
+def write_ebsd(file_name, args, step, phases, features, euler):
+    """ASCII EBSD file in the layout of the example structures."""
+    nz = args.nz if args.dim == 3 else 0
+    with open(file_name, 'w') as out:
+        out.write('# X_STEP: {}\n# Y_STEP: {}\n# Z_STEP: {}\n#\n'.format(
+            step, step, step if args.dim == 3 else 0))
+        out.write('# X_MIN: 0\n# Y_MIN: 0\n# Z_MIN: 0\n#\n')
+        out.write('# X_MAX: {}\n# Y_MAX: {}\n# Z_MAX: {}\n#\n'.format(
+            args.nx * step, args.ny * step, nz * step))
+        out.write('# X_DIM: {}\n# Y_DIM: {}\n# Z_DIM: {}\n#\n'.format(args.nx, args.ny, nz))
+        out.write('# Phase 1: Matrix\n# Features_1: 1\n# Phase 2: Yarn\n# Features_2: {}\n#\n'
+                  .format(max(features) if len(features) else 0))
+        out.write('# phi1 PHI phi2 x y z FeatureId PhaseId Symmetry\n')
+        idx = 0
+        for k in range(max(nz, 1)):
+            for j in range(args.ny):
+                for i in range(args.nx):
+                    out.write('{:g} {:g} {:g} {:.5f} {:.5f} {:.5f} {} {} 43\n'.format(
+                        euler[3 * idx], euler[3 * idx + 1], euler[3 * idx + 2],
+                        (i + 0.5) * step, (j + 0.5) * step,
+                        (k + 0.5) * step if args.dim == 3 else 0,
+                        features[idx], phases[idx]))
+                    idx += 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('output', help='Output file (.mcw or .txt)')
+    parser.add_argument('--layout', choices=['fiber', 'woven'], default='fiber')
+    parser.add_argument('--dim', type=int, choices=[2, 3], default=2)
+    parser.add_argument('--nx', type=int, default=128, help='Voxels in x')
+    parser.add_argument('--ny', type=int, default=128, help='Voxels in y')
+    parser.add_argument('--nz', type=int, default=1, help='Voxels in z (3D only)')
+    parser.add_argument('--step', type=float, default=2176.875,
+                        help='Voxel size in model units (default: the example structures)')
+    parser.add_argument('--format', choices=['mcw', 'ebsd'], default=None,
+                        help='Output format (default: from the file extension)')
+    parser.add_argument('--orientation', action='store_true',
+                        help='Store the yarn/fiber axis as Euler angles (degrees)')
+    parser.add_argument('--seed', type=int, default=0, help='Random seed of the fiber jitter')
+    parser.add_argument('--fiber-radius', type=float, default=6.0, help='Fiber radius in voxels')
+    parser.add_argument('--fiber-spacing', type=float, default=16.0,
+                        help='Distance between fiber centers in voxels')
+    parser.add_argument('--jitter', type=float, default=0.1,
+                        help='Random displacement of the fibers relative to the spacing')
+    parser.add_argument('--yarn-spacing', type=float, default=32.0,
+                        help='Distance between yarns in voxels')
+    parser.add_argument('--yarn-width', type=float, default=24.0, help='Yarn width in voxels')
+    parser.add_argument('--yarn-thickness', type=float, default=8.0,
+                        help='Yarn thickness in voxels')
+    parser.add_argument('--undulation', type=float, default=0.5,
+                        help='Amplitude of the yarn undulation relative to the thickness')
+    args = parser.parse_args()
+
+    if args.dim == 2:
+        args.nz = 1
+
+    n_voxels = args.nx * args.ny * args.nz
+    phases = array.array('i', [GAS]) * n_voxels
+    features = array.array('i', [0]) * n_voxels
+    euler = array.array('f', [0.0]) * (3 * n_voxels)
+
+    if args.layout == 'fiber':
+        voxelize_fibers(args, phases, features, euler)
+    else:
+        voxelize_woven(args, phases, features, euler)
+
+    fmt = args.format or ('ebsd' if args.output.endswith('.txt') else 'mcw')
+    if fmt == 'ebsd':
+        write_ebsd(args.output, args, args.step, phases, features, euler)
+    else:
+        step = [args.step, args.step, args.step if args.dim == 3 else 0.0]
+        write_mcw(args.output, args.dim, [args.nx, args.ny, args.nz], [0.0, 0.0, 0.0], step,
+                  2, phases, features, euler if args.orientation else None)
+
+    fiber_fraction = sum(1 for p in phases if p == FIBER) / float(n_voxels)
+    print('Wrote {} ({} {}D, {} x {} x {} voxels, fiber fraction {:.3f})'.format(
+        args.output, args.layout, args.dim, args.nx, args.ny, args.nz, fiber_fraction))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,290 @@
+#!/usr/bin/env python3
+"""
+Macaw performance benchmark driver.
+
+Runs the strong and weak scaling cases of a case file (default: cases.json) over the given
+numbers of MPI ranks and threads, collects the PerfGraphReporter sections, MemoryUsage and
+iteration counts from the JSON output of every run, and writes a machine readable report.
+The report can be stored as a baseline and later reports compared against it.
+
+Examples:
+  # Run all cases with the optimized executable and store the result as baseline
+  ./run_benchmarks.py --exec ../macaw-opt --output baseline.json
+
+  # Run the strong scaling cases on up to 4 ranks and compare with the baseline
+  ./run_benchmarks.py --mode strong --max-ranks 4 --output report.json --baseline baseline.json
+
+  # Include the unit micro-benchmarks
+  ./run_benchmarks.py --unit-exec ../unit/macaw-unit-opt --output report.json
+
+The exit code is 1 if any compared metric got worse than the tolerance.
+"""
+
+import argparse
+import datetime
+import json
+import os
+import platform
+import shlex
+import subprocess
+import sys
+import time
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+
+# Metrics compared against the baseline, larger is worse for all of them
+COMPARED_METRICS = ['wall_time', 'solve_time', 'mem_physical', 'mem_max_process', 'nl_its', 'l_its']
+
+
+def run(cmd, cwd, log_file):
+    """Run a command, stream its output into a log file and return the wall time."""
+    start = time.time()
+    with open(log_file, 'w') as log:
+        log.write(' '.join(shlex.quote(c) for c in cmd) + '\n')
+        log.flush()
+        ret = subprocess.call(cmd, cwd=cwd, stdout=log, stderr=subprocess.STDOUT)
+    if ret != 0:
+        sys.exit('Error: command failed with exit code {}, see {}'.format(ret, log_file))
+    return time.time() - start
+
+
+def structure_size(case, mode, procs):
+    """Voxel counts of a case, weak scaling grows the slowest (slab) axis."""
+    s = dict(case['structure'])
+    if mode == 'weak':
+        dims = ['nx', 'ny', 'nz'][:s['dim']]
+        other = 1
+        for d in dims[:-1]:
+            other *= s[d]
+        s[dims[-1]] = max(1, int(round(case['weak']['voxels_per_process'] * procs / other)))
+    return s
+
+
+def generate_structure(structure, file_name, work_dir):
+    args = [sys.executable, os.path.join(BENCH_DIR, 'generate_structure.py'), file_name]
+    for key, value in structure.items():
+        args += ['--' + key.replace('_', '-'), str(value)]
+    run(args, work_dir, os.path.join(work_dir, file_name + '.log'))
+
+
+def perf_sections(graph):
+    """Flatten a PerfGraphReporter graph into {section: {time, self_time, calls, memory}}."""
+    sections = {}
+
+    def visit(name, node):
+        if not isinstance(node, dict) or 'time' not in node:
+            return 0.0
+        children = {k: v for k, v in node.items() if isinstance(v, dict)}
+        self_time = float(node['time'])
+        total = self_time + sum(visit(k, v) for k, v in children.items())
+        entry = sections.setdefault(name, {'time': 0.0, 'self_time': 0.0, 'calls': 0, 'memory': 0})
+        entry['time'] += total
+        entry['self_time'] += self_time
+        entry['calls'] += int(node.get('num_calls', 0))
+        entry['memory'] = max(entry['memory'], int(node.get('memory', 0)))
+        return total
+
+    for name, node in graph.items():
+        visit(name, node)
+    return sections
+
+
+def reporter_value(step, name):
+    """Value of a postprocessor/reporter in one time step of the JSON output."""
+    value = step.get(name)
+    if isinstance(value, dict):
+        value = value.get('value', value)
+    return value
+
+
+def parse_json_output(json_file):
+    with open(json_file) as f:
+        data = json.load(f)
+    steps = data.get('time_steps', [])
+    if not steps:
+        sys.exit('Error: no time steps in ' + json_file)
+
+    result = {'n_steps': max(0, len(steps) - 1)}
+    for name in ['n_elements', 'n_dofs']:
+        result[name] = reporter_value(steps[0], name)
+
+    # Memory is the peak over the run, iterations the sum over all steps
+    for name in ['mem_physical', 'mem_max_process']:
+        values = [reporter_value(s, name) for s in steps]
+        result[name] = max(v for v in values if v is not None)
+    for name in ['nl_its', 'l_its']:
+        result[name] = sum(reporter_value(s, name) or 0 for s in steps)
+
+    graph = None
+    for step in reversed(steps):
+        perf = step.get('perf_graph')
+        if isinstance(perf, dict):
+            graph = perf.get('perf_graph', perf)
+            graph = graph.get('graph', graph)
+            break
+    if graph is None:
+        sys.exit('Error: no perf_graph reporter in ' + json_file)
+
+    result['sections'] = perf_sections(graph)
+    solve = [v['time'] for k, v in result['sections'].items() if k.endswith('::solve')]
+    result['solve_time'] = max(solve) if solve else None
+    return result
+
+
+def run_case(args, config, case, mode, ranks, threads):
+    procs = ranks * threads
+    structure = structure_size(case, mode, procs)
+    name = '{}_{}_r{}_t{}'.format(case['name'], mode, ranks, threads)
+    work_dir = os.path.join(args.work_dir, name)
+    os.makedirs(work_dir, exist_ok=True)
+
+    generate_structure(structure, 'structure.mcw', work_dir)
+
+    cmd = []
+    if ranks > 1 or args.always_mpiexec:
+        cmd += shlex.split(args.mpiexec) + ['-n', str(ranks)]
+    cmd += [os.path.abspath(args.exec), '-i', os.path.join(BENCH_DIR, config['input']),
+            '--n-threads={}'.format(threads),
+            'Executioner/num_steps={}'.format(config.get('num_steps', 5)),
+            'Outputs/file_base=benchmark']
+    print('Running {} ...'.format(name), flush=True)
+    wall = run(cmd, work_dir, os.path.join(work_dir, 'console.log'))
+
+    result = parse_json_output(os.path.join(work_dir, 'benchmark.json'))
+    result.update({'case': case['name'], 'mode': mode, 'ranks': ranks, 'threads': threads,
+                   'structure': structure, 'wall_time': wall})
+    return name, result
+
+
+def run_unit_benchmarks(args):
+    """Run the unit micro-benchmarks and collect their recorded properties."""
+    out = os.path.join(args.work_dir, 'unit_benchmarks.json')
+    cmd = [os.path.abspath(args.unit_exec), '--gtest_filter=*Benchmark*',
+           '--gtest_also_run_disabled_tests',
+           '--gtest_output=json:' + out]
+    run(cmd, args.work_dir, os.path.join(args.work_dir, 'unit_benchmarks.log'))
+    with open(out) as f:
+        data = json.load(f)
+
+    results = {}
+    for suite in data.get('testsuites', []):
+        for test in suite.get('testsuite', []):
+            values = {k: float(v) for k, v in test.items()
+                      if k.endswith('_ns') or k.endswith('_speedup')}
+            if values:
+                name = test['name'].replace('DISABLED_', '')
+                results['{}.{}'.format(suite['name'], name)] = values
+    return results
+
+
+def compare(report, baseline, tolerance, section_fraction):
+    """Print the relative change of every metric, return the list of regressions."""
+    regressions = []
+    print('\n{:40s} {:28s} {:>12s} {:>12s} {:>8s}'.format('case', 'metric', 'baseline', 'current', 'change'))
+
+    def check(case, metric, base, cur, larger_is_worse=True):
+        if base is None or cur is None or base == 0:
+            return
+        change = (cur - base) / abs(base)
+        worse = change > tolerance if larger_is_worse else change < -tolerance
+        flag = '  <-- regression' if worse else ''
+        print('{:40s} {:28s} {:12.4g} {:12.4g} {:+7.1%}{}'.format(case, metric[:28], base, cur, change, flag))
+        if worse:
+            regressions.append((case, metric, base, cur, change))
+
+    for name, cur in sorted(report['cases'].items()):
+        base = baseline.get('cases', {}).get(name)
+        if base is None:
+            print('{:40s} not in baseline'.format(name))
+            continue
+        for metric in COMPARED_METRICS:
+            check(name, metric, base.get(metric), cur.get(metric))
+
+        # Only sections that take a relevant part of the run
+        for section, values in cur['sections'].items():
+            base_section = base['sections'].get(section)
+            if base_section and base_section['time'] > section_fraction * base['wall_time']:
+                check(name, section, base_section['time'], values['time'])
+
+    for name, cur in sorted(report.get('unit', {}).items()):
+        base = baseline.get('unit', {}).get(name, {})
+        for metric, value in cur.items():
+            check(name, metric, base.get(metric), value, larger_is_worse=metric.endswith('_ns'))
+
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--exec', default=os.path.join(BENCH_DIR, '..', 'macaw-opt'),
+                        help='Macaw executable')
+    parser.add_argument('--unit-exec', default=None,
+                        help='Unit test executable, runs the *Benchmark* tests if given')
+    parser.add_argument('--config', default=os.path.join(BENCH_DIR, 'cases.json'),
+                        help='Case file')
+    parser.add_argument('--cases', nargs='*', default=None, help='Only run these cases')
+    parser.add_argument('--mode', choices=['strong', 'weak', 'both'], default='both')
+    parser.add_argument('--max-ranks', type=int, default=None,
+                        help='Skip runs with more MPI ranks')
+    parser.add_argument('--max-threads', type=int, default=None,
+                        help='Skip runs with more threads per rank')
+    parser.add_argument('--mpiexec', default='mpiexec', help='MPI launcher command')
+    parser.add_argument('--always-mpiexec', action='store_true',
+                        help='Use the MPI launcher for single rank runs as well')
+    parser.add_argument('--work-dir', default='benchmark_runs', help='Directory for the runs')
+    parser.add_argument('--output', default='benchmark_report.json', help='Report file')
+    parser.add_argument('--baseline', default=None, help='Baseline report to compare with')
+    parser.add_argument('--tolerance', type=float, default=0.1,
+                        help='Relative change counted as regression')
+    parser.add_argument('--section-fraction', type=float, default=0.01,
+                        help='Only compare sections taking at least this fraction of the wall time')
+    args = parser.parse_args()
+
+    with open(args.config) as f:
+        config = json.load(f)
+    args.work_dir = os.path.abspath(args.work_dir)
+    os.makedirs(args.work_dir, exist_ok=True)
+
+    git = subprocess.run(['git', 'rev-parse', 'HEAD'], cwd=BENCH_DIR,
+                         stdout=subprocess.PIPE, stderr=subprocess.DEVNULL, universal_newlines=True)
+    report = {'date': datetime.datetime.now().isoformat(timespec='seconds'),
+              'host': platform.node(),
+              'commit': git.stdout.strip(),
+              'executable': os.path.abspath(args.exec),
+              'cases': {}}
+
+    modes = ['strong', 'weak'] if args.mode == 'both' else [args.mode]
+    for case in config['cases']:
+        if args.cases and case['name'] not in args.cases:
+            continue
+        for mode in modes:
+            if mode not in case:
+                continue
+            for ranks in case[mode]['ranks']:
+                for threads in case[mode].get('threads', [1]):
+                    if (args.max_ranks and ranks > args.max_ranks) or \
+                       (args.max_threads and threads > args.max_threads):
+                        continue
+                    name, result = run_case(args, config, case, mode, ranks, threads)
+                    report['cases'][name] = result
+
+    if args.unit_exec:
+        report['unit'] = run_unit_benchmarks(args)
+
+    with open(args.output, 'w') as f:
+        json.dump(report, f, indent=2, sort_keys=True)
+    print('Wrote ' + args.output)
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        regressions = compare(report, baseline, args.tolerance, args.section_fraction)
+        if regressions:
+            print('\n{} regression(s) beyond {:.0%}'.format(len(regressions), args.tolerance))
+            sys.exit(1)
+        print('\nNo regressions beyond {:.0%}'.format(args.tolerance))
+
+
+if __name__ == '__main__':
+    main()
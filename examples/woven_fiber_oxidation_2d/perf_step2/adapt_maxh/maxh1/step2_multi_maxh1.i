@@ -39,10 +39,7 @@
   [solution_uo]
     type = SolutionUserObject
     mesh = ../../../step1/step1_multi_exodus.e
-    system_variables = 'eta_f eta_g
-                        var_00 var_01 var_02
-                        var_10 var_11 var_12
-                        var_20 var_21 var_22'
+    system_variables = 'eta_f eta_g'
     timestep = 'LATEST'
   []
 
@@ -105,54 +102,6 @@
     from_variable = eta_g
     solution = solution_uo
   []
-
-  [ic_func_00]
-    type = SolutionFunction
-    from_variable = var_00
-    solution = solution_uo
-  []
-  [ic_func_01]
-    type = SolutionFunction
-    from_variable = var_01
-    solution = solution_uo
-  []
-  [ic_func_02]
-    type = SolutionFunction
-    from_variable = var_02
-    solution = solution_uo
-  []
-
-  [ic_func_10]
-    type = SolutionFunction
-    from_variable = var_10
-    solution = solution_uo
-  []
-  [ic_func_11]
-    type = SolutionFunction
-    from_variable = var_11
-    solution = solution_uo
-  []
-  [ic_func_12]
-    type = SolutionFunction
-    from_variable = var_12
-    solution = solution_uo
-  []
-
-  [ic_func_20]
-    type = SolutionFunction
-    from_variable = var_20
-    solution = solution_uo
-  []
-  [ic_func_21]
-    type = SolutionFunction
-    from_variable = var_21
-    solution = solution_uo
-  []
-  [ic_func_22]
-    type = SolutionFunction
-    from_variable = var_22
-    solution = solution_uo
-  []
 []
 
 #------------------------------------------------------------------------------#
@@ -189,54 +138,6 @@
     variable = T
     function = ic_func_T
   []
-
-  [IC_00]
-    type = FunctionIC
-    variable = var_00
-    function = ic_func_00
-  []
-  [IC_01]
-    type = FunctionIC
-    variable = var_01
-    function = ic_func_01
-  []
-  [IC_02]
-    type = FunctionIC
-    variable = var_02
-    function = ic_func_02
-  []
-
-  [IC_10]
-    type = FunctionIC
-    variable = var_10
-    function = ic_func_10
-  []
-  [IC_11]
-    type = FunctionIC
-    variable = var_11
-    function = ic_func_11
-  []
-  [IC_12]
-    type = FunctionIC
-    variable = var_12
-    function = ic_func_12
-  []
-
-  [IC_20]
-    type = FunctionIC
-    variable = var_20
-    function = ic_func_20
-  []
-  [IC_21]
-    type = FunctionIC
-    variable = var_21
-    function = ic_func_21
-  []
-  [IC_22]
-    type = FunctionIC
-    variable = var_22
-    function = ic_func_22
-  []
 []
 
 #------------------------------------------------------------------------------#
@@ -258,45 +159,6 @@
     initial_condition = 3000
   []
 
-  [var_00]
-    order = CONSTANT
-    family = MONOMIAL
-  []
-  [var_01]
-    order = CONSTANT
-    family = MONOMIAL
-  []
-  [var_02]
-    order = CONSTANT
-    family = MONOMIAL
-  []
-
-  [var_10]
-    order = CONSTANT
-    family = MONOMIAL
-  []
-  [var_11]
-    order = CONSTANT
-    family = MONOMIAL
-  []
-  [var_12]
-    order = CONSTANT
-    family = MONOMIAL
-  []
-
-  [var_20]
-    order = CONSTANT
-    family = MONOMIAL
-  []
-  [var_21]
-    order = CONSTANT
-    family = MONOMIAL
-  []
-  [var_22]
-    order = CONSTANT
-    family = MONOMIAL
-  []
-
   [flux_c_x]
     order = CONSTANT
     family = MONOMIAL
@@ -329,6 +191,21 @@
     family = MONOMIAL
     initial_condition = 0.0
   []
+
+  # Fiber conductivity tensor for visualization, written once per mesh by the
+  # XDMF output (static_variables)
+  [thcond_f_xx]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [thcond_f_xy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [thcond_f_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
 []
 
 #------------------------------------------------------------------------------#
@@ -403,6 +280,32 @@
     component = y
   []
 
+  # Set once, refined elements inherit the tensor like OrientationFieldMaterial
+  [aux_thcond_f_xx]
+    type = MaterialRealTensorValueAux
+    variable = thcond_f_xx
+    property = thcond_f
+    row = 0
+    column = 0
+    execute_on = 'INITIAL'
+  []
+  [aux_thcond_f_xy]
+    type = MaterialRealTensorValueAux
+    variable = thcond_f_xy
+    property = thcond_f
+    row = 0
+    column = 1
+    execute_on = 'INITIAL'
+  []
+  [aux_thcond_f_yy]
+    type = MaterialRealTensorValueAux
+    variable = thcond_f_yy
+    property = thcond_f
+    row = 1
+    column = 1
+    execute_on = 'INITIAL'
+  []
+
 [] # End of AuxKernels
 
 #------------------------------------------------------------------------------#
@@ -1163,17 +1066,18 @@
 
   #----------------------------------------------------------------------------#
   # Heat conduction parameters
+  # The tensor is read from the orientation field file written by step1 instead
+  # of nine transferred aux variables. It is not part of the solution state, so
+  # checkpoints do not carry it and a recovered run reads the file again.
+  # step1 runs on ExampleFiber_2D without pre-refinement and this study on
+  # FiberOxOB_2D with pre_refine = 1, so no element id matches the file: every
+  # element takes the record with the closest centroid. This is the intended
+  # path here, the per element counterpart of the SolutionUserObject sampling
+  # of the step1 order parameters.
   [thcond_f]
-    type = VariabletoTensor
-    var_xx = var_00
-    var_xy = var_01
-    var_xz = var_02
-    var_yx = var_10
-    var_yy = var_11
-    var_yz = var_12
-    var_zx = var_20
-    var_zy = var_21
-    var_zz = var_22
+    type = OrientationFieldMaterial
+    file = ../../../step1/step1_orientation_field.bin
+    static_tensor = true
 
     M_name = thcond_f
   []
@@ -1348,13 +1252,6 @@
 
   scheme = bdf2
 
-  # [Adaptivity]
-  #   # interval = 2
-  #   refine_fraction = 0.6
-  #   coarsen_fraction = 0.9
-  #   max_h_level = 1
-  # []
-
   [TimeStepper]
     type = IterationAdaptiveDT
     dt = 1
@@ -1370,6 +1267,26 @@
 
 []
 
+#------------------------------------------------------------------------------#
+[Adaptivity]
+  # Refine within 1.5 interface widths of the fiber interface and coarsen beyond
+  # 3 widths, leaving the elements in between alone. On the equilibrium profile
+  # eta = (1 - tanh(2 s / width)) / 2 the distance |s| < d * width is the order
+  # parameter range |1 - 2 eta| < tanh(2 d), independent of the width.
+  marker = band
+  max_h_level = 1
+  [Markers]
+    [band]
+      type = ValueRangeMarker
+      variable = eta_f
+      lower_bound = ${fparse 0.5 * (1 - tanh(2 * 1.5))}
+      upper_bound = ${fparse 0.5 * (1 + tanh(2 * 1.5))}
+      buffer_size = ${fparse 0.5 * (tanh(2 * 3) - tanh(2 * 1.5))}
+      third_state = DO_NOTHING
+    []
+  []
+[]
+
 #------------------------------------------------------------------------------#
 #####    ####    ####   #####
 #    #  #    #  #         #
@@ -1613,10 +1530,14 @@
     max_rows = 10
   []
 
-  [exodus]
-    type = Exodus
+  # The mesh and the conductivity tensor are written once per mesh change, the
+  # other fields every output step
+  [xdmf]
+    type = StaticAwareXDMF
+    static_variables = 'thcond_f_xx thcond_f_xy thcond_f_yy'
     append_date = True
     time_step_interval = 3
+    precision = single
   []
 
   [csv]
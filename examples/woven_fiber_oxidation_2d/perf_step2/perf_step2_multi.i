@@ -1176,6 +1176,9 @@
     var_zz = var_22
 
     M_name = thcond_f
+
+    # The transferred tensor is constant, compute it once per element
+    static_tensor = true
   []
 
   [thcond_g]
@@ -1590,6 +1593,12 @@
     mem_units = megabytes
     value_type = max_process
   []
+  [mem_static_thcond_f_mb]
+    type = StaticTensorCacheMemory
+    material = thcond_f
+    mem_units = megabytes
+    value_type = total
+  []
 []
 
 #------------------------------------------------------------------------------#
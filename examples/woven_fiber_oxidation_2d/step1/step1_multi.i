@@ -53,6 +53,13 @@ ev = 6.242e18 #conversion from J to EV
     # Read in the EBSD data. Uses the filename given in the mesh block.
     type = EBSDReader
   []
+
+  # Writes the conductivity tensor per element for OrientationFieldMaterial in step2
+  [orientation_writer]
+    type = OrientationFieldWriter
+    file = step1_orientation_field.bin
+    tensor = thcond_aniso
+  []
 []
 
 #------------------------------------------------------------------------------#
@@ -419,66 +419,34 @@ ev = 6.242e18 #conversion from J to EV
 [Kernels]
   # Chemical reaction
   [reaction_kernel_C]
-    type = MaskedBodyForce
+    type = PhaseFieldMaterialReaction
     variable = w_c
-    mask = reaction_CO
-    coupled_variables = 'w_o eta_f eta_g T'
+    mat_function = reaction_CO
+    args = 'w_o eta_f eta_g T'
   []
 
   [reaction_kernel_O]
-    type = MaskedBodyForce
+    type = PhaseFieldMaterialReaction
     variable = w_o
-    mask = reaction_CO
-    coupled_variables = 'w_c eta_f eta_g T'
+    mat_function = reaction_CO
+    args = 'w_c eta_f eta_g T'
   []
 
   [reaction_kernel_CO]
-    type = MaskedBodyForce
+    type = PhaseFieldMaterialReaction
     variable = w_co
-    mask = production_CO
-    coupled_variables = 'w_c w_o eta_f eta_g T'
+    mat_function = production_CO
+    args = 'w_c w_o eta_f eta_g T'
   []
 
   #----------------------------------------------------------------------------#
   # Endothermic Reaction
   [reaction_energy_CO]
-    type = MaskedBodyForce
+    type = PhaseFieldMaterialReaction
     variable = T
-    mask = energy_CO
-    coupled_variables = 'w_c w_o eta_f eta_g'
+    mat_function = energy_CO
+    args = 'w_c w_o eta_f eta_g'
   []
-  
-  
-  # # Chemical reaction
-  # [reaction_kernel_C]
-  #   type = PhaseFieldMaterialReaction
-  #   variable = w_c
-  #   mat_function = reaction_CO
-  #   args = 'w_c w_o eta_f eta_g T'
-  # []
-
-  # [reaction_kernel_O]
-  #   type = PhaseFieldMaterialReaction
-  #   variable = w_o
-  #   mat_function = reaction_CO
-  #   args = 'w_c w_o eta_f eta_g T'
-  # []
-
-  # [reaction_kernel_CO]
-  #   type = PhaseFieldMaterialReaction
-  #   variable = w_co
-  #   mat_function = production_CO
-  #   args = 'w_co w_c w_o eta_f eta_g T'
-  # []
-
-  # #----------------------------------------------------------------------------#
-  # Endothermic Reaction
-  # [reaction_energy_CO]
-  #   type = PhaseFieldMaterialReaction
-  #   variable = T
-  #   mat_function = energy_CO
-  #   args = 'w_c w_o eta_f eta_g'
-  # []
 
   #----------------------------------------------------------------------------#
   # eta_f kernels
@@ -700,41 +668,22 @@ ev = 6.242e18 #conversion from J to EV
 #------------------------------------------------------------------------------#
 [Materials]
   #----------------------------------------------------------------------------#
-  # Reaction expressions
-  [CO_reaction_production]
-    type = DerivativeParsedMaterial
-    property_name = production_CO
-    coupled_variables = 'w_c w_o eta_f eta_g T'
-
-    expression= 'if(rho_c>K_tol&rho_o>K_tol,K_CO*rho_c*rho_o,0)'
-
-    material_property_names = 'K_CO(T) rho_c(w_c,eta_f,eta_g) rho_o(w_o,eta_f,eta_g) K_tol'
-  []
-
-  [CO_reaction_consumption]
-    type = DerivativeParsedMaterial
-    property_name = reaction_CO
-    coupled_variables = 'w_c w_o eta_f eta_g T'
-
-    expression= 'if(rho_c>K_tol&rho_o>K_tol,-K_CO*rho_c*rho_o,0)'
-
-    material_property_names = 'K_CO(T) rho_c(w_c,eta_f,eta_g) rho_o(w_o,eta_f,eta_g) K_tol'
-  []
-
-  #----------------------------------------------------------------------------#
-  # Reaction Energy
-  [CO_reaction_energy] # Endothermic
-    type = DerivativeParsedMaterial
-    property_name = energy_CO
+  # Reaction rates, consumption and reaction energy (endothermic)
+  [CO_reaction]
+    type = OxidationReactionMaterial
+    rho_a = rho_c
+    rho_b = rho_o
+    temperature = T
     coupled_variables = 'w_c w_o eta_f eta_g T'
 
-    expression= 'if(rho_c>K_tol&rho_o>K_tol,-dH*K_CO*rho_c*rho_o,0)'
+    property_names = 'production_CO reaction_CO energy_CO'
+    coefficients   = '1             -1          ${fparse -100*1000*ev/(Av*eo)}' # dH = 100 kJ/mol
 
-    constant_names = 'dH'
-
-    constant_expressions = ${fparse 100*1000*ev/(Av*eo)} #'2.6575e-01' # = 100 kJ/mol = 1.0365ev/atom
-
-    material_property_names = 'K_CO(T) rho_c(w_c,eta_f,eta_g) rho_o(w_o,eta_f,eta_g) K_tol'
+    K_pre = ${fparse 6.35150327e-08*to/(lo^3)}
+    Q = -1.62742301e-01
+    k_Boltz = 8.6173e-5
+    int_width = 4644 # eta's width
+    tolerance = 1e-4
   []
 
   #----------------------------------------------------------------------------#
@@ -754,42 +703,34 @@ ev = 6.242e18 #conversion from J to EV
   []
 
   #----------------------------------------------------------------------------#
-  # Grand potential densities
-  # Fibers: Dilute solution model
-  [omega_f]
-    type = DerivativeParsedMaterial
-    property_name = omega_f
-    coupled_variables = 'w_c w_o w_co'
-
-    expression= '-w_c/Va -k_b*To/Va * exp(-(w_c+Ef_v)/(k_b*To))
-                -k_b*To/Va * exp((w_o-Ef_o_f)/(k_b*To))
-                -k_b*To/Va * exp((w_co-Ef_co_f)/(k_b*To))'
-
-    material_property_names = 'To k_b Va Ef_o_f Ef_co_f Ef_v'
-  []
-
-  # Gas phase: Parabolic
-  [omega_g]
-    type = DerivativeParsedMaterial
-    property_name = omega_g
-    coupled_variables = 'w_c w_o w_co'
-
-    expression= '-1/2*w_c^2/(Va^2*A_c_g) -w_c*xeq_c_g/Va
-                -1/2*w_o^2/(Va^2*A_o_g) -w_o*xeq_o_g/Va
-                -1/2*w_co^2/(Va^2*A_co_g) -w_co*xeq_co_g/Va'
-
-    material_property_names = 'Va A_o_g A_c_g A_co_g xeq_o_g xeq_c_g xeq_co_g'
-  []
-
-  [omega]
-    type = DerivativeParsedMaterial
-    property_name = omega
-    coupled_variables = 'w_c w_o w_co eta_f eta_g'
+  # Grand potential densities, number densities, site fractions,
+  # susceptibilities, diffusivities and mobilities of C, O and CO
+  # Fibers: Dilute solution model, gas phase: Parabolic
+  [grand_potential]
+    type = GrandPotentialOxidation2PhaseMaterial
+    w = 'w_c w_o w_co'
+    etas = 'eta_f eta_g'
+    h_names = 'h_f h_g'
+
+    phase_names = 'f g'
+    species_names = 'c o co'
+
+    #                    fiber: c o co, gas: c o co
+    free_energy_models = 'saturated dilute dilute parabolic parabolic parabolic'
+    formation_energies = '${fparse 3.9/eo} ${fparse 6.10/eo} ${fparse 6.31/eo} 0 0 0'
+    A = '0 0 0 ${fparse 7.82e1/(1e-9)*lo^3/eo} ${fparse 3.91e-4/(1e-9)*lo^3/eo}
+         ${fparse 3.91e-4/(1e-9)*lo^3/eo}'
+    xeq = '0 0 0 0.0 0.999 0.0'
+    diffusivities = '${fparse 1.07e-12*1e8*to/lo^2} ${fparse 3e-3*1e8*to/lo^2}
+                     ${fparse 3e-3*1e8*to/lo^2} ${fparse 1*1e8*to/lo^2}
+                     ${fparse 1*1e8*to/lo^2} ${fparse 1*1e8*to/lo^2}'
+
+    k_b = ${fparse 8.6173e-5/eo}
+    T = 3000
+    Va = ${fparse 9.97e-12/lo^3}
 
-    expression= 'h_f*omega_f + h_g*omega_g'
-
-    material_property_names = 'h_f(eta_f,eta_g) h_g(eta_f,eta_g) omega_f(w_c,w_o,w_co)
-                              omega_g(w_c,w_o,w_co)'
+    outputs = exodus
+    output_properties = 'x_c x_o x_co'
   []
 
   [out_omega_f]
@@ -828,49 +769,6 @@ ev = 6.242e18 #conversion from J to EV
 
   #----------------------------------------------------------------------------#
   # CARBON
-  [rho_c_f]
-    type = DerivativeParsedMaterial
-    property_name = rho_c_f
-    coupled_variables = 'w_c'
-
-    expression= '1/Va*(1 - exp(-(w_c+Ef_v)/(k_b*To)))'
-
-    material_property_names = 'To Va Ef_v k_b'
-  []
-
-  [rho_c_g]
-    type = DerivativeParsedMaterial
-    property_name = rho_c_g
-    coupled_variables = 'w_c'
-
-    expression= '1/Va*(w_c/(Va*A_c_g) + xeq_c_g)'
-
-    material_property_names = 'Va A_c_g xeq_c_g'
-  []
-
-  [rho_c]
-    type = DerivativeParsedMaterial
-    property_name = rho_c
-    coupled_variables = 'w_c eta_f eta_g'
-
-    expression= 'h_f*rho_c_f + h_g*rho_c_g'
-
-    material_property_names = 'h_f(eta_f,eta_g) h_g(eta_f,eta_g) rho_c_f(w_c) rho_c_g(w_c)'
-  []
-
-  [x_c]
-    type = DerivativeParsedMaterial
-    property_name = x_c
-    coupled_variables = 'w_c eta_f eta_g'
-
-    expression= 'Va*(h_f*rho_c_f + h_g*rho_c_g)'
-
-    material_property_names = 'Va h_f(eta_f,eta_g) h_g(eta_f,eta_g) rho_c_f(w_c) rho_c_g(w_c)'
-
-    outputs = exodus
-    output_properties = x_c
-  []
-
   [c_fiber_out]
     type = ParsedMaterial
     property_name = x_c_out
@@ -882,49 +780,6 @@ ev = 6.242e18 #conversion from J to EV
 
   #----------------------------------------------------------------------------#
   # OXYGEN
-  [rho_o_f]
-    type = DerivativeParsedMaterial
-    property_name = rho_o_f
-    coupled_variables = 'w_o'
-
-    expression= '1/Va * exp((w_o-Ef_o_f)/(k_b*To))'
-
-    material_property_names = 'To Va Ef_o_f k_b'
-  []
-
-  [rho_o_g]
-    type = DerivativeParsedMaterial
-    property_name = rho_o_g
-    coupled_variables = 'w_o'
-
-    expression= '1/Va*(w_o/(Va*A_o_g) + xeq_o_g)'
-
-    material_property_names = 'Va A_o_g xeq_o_g'
-  []
-
-  [rho_o]
-    type = DerivativeParsedMaterial
-    property_name = rho_o
-    coupled_variables = 'w_o eta_f eta_g'
-
-    expression= 'h_f*rho_o_f + h_g*rho_o_g'
-
-    material_property_names = 'h_f(eta_f,eta_g) h_g(eta_f,eta_g) rho_o_f(w_o) rho_o_g(w_o)'
-  []
-
-  [x_o]
-    type = DerivativeParsedMaterial
-    property_name = x_o
-    coupled_variables = 'w_o eta_f eta_g'
-
-    expression= 'Va*(h_f*rho_o_f + h_g*rho_o_g)'
-
-    material_property_names = 'Va h_f(eta_f,eta_g) h_g(eta_f,eta_g) rho_o_f(w_o) rho_o_g(w_o)'
-
-    outputs = exodus
-    output_properties = x_o
-  []
-
   [o_gas_out]
     type = ParsedMaterial
     property_name = x_o_out
@@ -936,49 +791,6 @@ ev = 6.242e18 #conversion from J to EV
 
   #----------------------------------------------------------------------------#
   # CARBON MONOXIDE
-  [rho_co_f]
-    type = DerivativeParsedMaterial
-    property_name = rho_co_f
-    coupled_variables = 'w_co'
-
-    expression= '1/Va * exp((w_co-Ef_co_f)/(k_b*To))'
-
-    material_property_names = 'To Va Ef_co_f k_b'
-  []
-
-  [rho_co_g]
-    type = DerivativeParsedMaterial
-    property_name = rho_co_g
-    coupled_variables = 'w_co'
-
-    expression= '1/Va*(w_co/(Va*A_co_g) + xeq_co_g)'
-
-    material_property_names = 'Va A_co_g xeq_co_g'
-  []
-
-  [rho_co]
-    type = DerivativeParsedMaterial
-    property_name = rho_co
-    coupled_variables = 'w_co eta_f eta_g'
-
-    expression= 'h_f*rho_co_f + h_g*rho_co_g'
-
-    material_property_names = 'h_f(eta_f,eta_g) h_g(eta_f,eta_g) rho_co_f(w_co) rho_co_g(w_co)'
-  []
-
-  [x_co]
-    type = DerivativeParsedMaterial
-    property_name = x_co
-    coupled_variables = 'w_co eta_f eta_g'
-
-    expression= 'Va*(h_f*rho_co_f + h_g*rho_co_g)'
-
-    material_property_names = 'Va h_f(eta_f,eta_g) h_g(eta_f,eta_g) rho_co_f(w_co) rho_co_g(w_co)'
-
-    outputs = exodus
-    output_properties = x_co
-  []
-
   [co_gas_out]
     type = ParsedMaterial
     property_name = x_co_out
@@ -988,41 +800,6 @@ ev = 6.242e18 #conversion from J to EV
     material_property_names = 'h_g x_co'
   []
 
-  #----------------------------------------------------------------------------#
-  # Susceptibilities
-  [chi_c]
-    type = DerivativeParsedMaterial
-    property_name = chi_c
-    coupled_variables = 'w_c eta_f eta_g'
-
-    expression= 'h_f*(1/(Va*k_b*To) * exp(-(w_c+Ef_v)/(k_b*To)))
-                +h_g*(1/(Va^2*A_c_g))'
-
-    material_property_names = 'h_f(eta_f,eta_g) h_g(eta_f,eta_g) k_b Ef_v Va A_c_g To'
-  []
-
-  [chi_o]
-    type = DerivativeParsedMaterial
-    property_name = chi_o
-    coupled_variables = 'w_o eta_f eta_g'
-
-    expression= 'h_f*(1/(Va*k_b*To) * exp((w_o-Ef_o_f)/(k_b*To)))
-                +h_g*(1/(Va^2*A_o_g))'
-
-    material_property_names = 'h_f(eta_f,eta_g) h_g(eta_f,eta_g) k_b Ef_o_f Va A_o_g To'
-  []
-
-  [chi_co]
-    type = DerivativeParsedMaterial
-    property_name = chi_co
-    coupled_variables = 'w_co eta_f eta_g'
-
-    expression= 'h_f*(1/(Va*k_b*To) * exp((w_co-Ef_co_f)/(k_b*To)))
-                +h_g*(1/(Va^2*A_co_g))'
-
-    material_property_names = 'h_f(eta_f,eta_g) h_g(eta_f,eta_g) k_b Ef_co_f Va A_co_g To'
-  []
-
   #----------------------------------------------------------------------------#
   #####     ##    #####     ##    #    #   ####
   #    #   #  #   #    #   #  #   ##  ##  #
@@ -1031,18 +808,6 @@ ev = 6.242e18 #conversion from J to EV
   #       #    #  #   #   #    #  #    #  #    #
   #       #    #  #    #  #    #  #    #   ####
   #----------------------------------------------------------------------------#
-  #----------------------------------------------------------------------------#
-  # Reaction rate
-  [reactivity_CO]
-    type = DerivativeParsedMaterial
-    property_name = K_CO
-    coupled_variables = 'T'
-
-    expression= 'K_pre/int_width * exp(-Q/(k_Boltz*T))'
-
-    material_property_names = 'int_width K_pre Q k_Boltz'
-  []
-
   #----------------------------------------------------------------------------#
   # Reaction rate params
   [K_params]
@@ -1100,101 +865,6 @@ ev = 6.242e18 #conversion from J to EV
     sigma_index = 0
   []
 
-  #----------------------------------------------------------------------------#
-  # Constant parameters
-  [params]
-    type = GenericConstantMaterial
-    prop_names = 'To     k_b                      Va'
-    prop_values = '3000  ${fparse 8.6173e-5/eo}  ${fparse 9.97e-12/lo^3}' #2.2096e-05  1.0'
-  []
-
-  [formation_energies]
-    type = GenericConstantMaterial
-    prop_names = 'Ef_v                Ef_o_f            Ef_co_f'
-    prop_values = '${fparse 3.9/eo}  ${fparse 6.10/eo}  ${fparse 6.31/eo}' #'1   1.5641e+00        1.6179e+00'
-  []
-
-  [params_carbon]
-    type = GenericConstantMaterial
-    prop_names = 'A_c_g                             xeq_c_g'
-    prop_values = '${fparse 7.82e1/(1e-9)*lo^3/eo}  0.0'      #'2e-1           0.0'
-  []
-
-  [params_oxygen]
-    type = GenericConstantMaterial
-    prop_names = 'A_o_g                               xeq_o_g'
-    prop_values = '${fparse 3.91e-4/(1e-9)*lo^3/eo}    0.999'    #'1e-6          0.999'
-  []
-  [params_mono]
-    type = GenericConstantMaterial
-    prop_names = 'A_co_g       xeq_co_g'
-    prop_values = '${fparse 3.91e-4/(1e-9)*lo^3/eo}    0.0'   #'1e-6           0.0'
-  []
-
-  #----------------------------------------------------------------------------#
-  # Diffusivities
-  [diff_c]
-    type = DerivativeParsedMaterial
-    property_name = D_c
-    coupled_variables = 'eta_f eta_g'
-
-    expression= 'h_f*${fparse 1.07e-12*1e8*to/lo^2} + h_g*${fparse 1*1e8*to/lo^2}'   #'h_f*1 + h_g*9.3458e+11'
-
-    material_property_names = 'h_f(eta_f,eta_g) h_g(eta_f,eta_g)'
-  []
-
-  [diff_o]
-    type = DerivativeParsedMaterial
-    property_name = D_o
-    coupled_variables = 'eta_f eta_g'
-
-    expression= 'h_f*${fparse 3e-3*1e8*to/lo^2} + h_g*${fparse 1*1e8*to/lo^2}'  #'h_f*2.8037e+09 + h_g*9.3458e+11'
-
-    material_property_names = 'h_f(eta_f,eta_g) h_g(eta_f,eta_g)'
-  []
-
-  [diff_co]
-    type = DerivativeParsedMaterial
-    property_name = D_co
-    coupled_variables = 'eta_f eta_g'
-
-    expression= 'h_f*${fparse 3e-3*1e8*to/lo^2} + h_g*${fparse 1*1e8*to/lo^2}'  #'h_f*2.8037e+09 + h_g*9.3458e+11'
-
-    material_property_names = 'h_f(eta_f,eta_g) h_g(eta_f,eta_g)'
-  []
-
-  #----------------------------------------------------------------------------#
-  # Mobilities
-  [mob_c]
-    type = DerivativeParsedMaterial
-    property_name = Dchi_c
-    coupled_variables = 'w_c eta_f eta_g'
-
-    expression= 'D_c*chi_c'
-
-    material_property_names = 'D_c(eta_f,eta_g) chi_c(w_c,eta_f,eta_g)'
-  []
-
-  [mob_o]
-    type = DerivativeParsedMaterial
-    property_name = Dchi_o
-    coupled_variables = 'w_o eta_f eta_g'
-
-    expression= 'D_o*chi_o'
-
-    material_property_names = 'D_o(eta_f,eta_g) chi_o(w_o,eta_f,eta_g)'
-  []
-
-  [mob_co]
-    type = DerivativeParsedMaterial
-    property_name = Dchi_co
-    coupled_variables = 'w_co eta_f eta_g'
-
-    expression= 'D_co*chi_co'
-
-    material_property_names = 'D_co(eta_f,eta_g) chi_co(w_co,eta_f,eta_g)'
-  []
-
   #----------------------------------------------------------------------------#
   # Heat conduction parameters
   [thcond_f]
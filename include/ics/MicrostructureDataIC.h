@@ -0,0 +1,35 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "InitialCondition.h"
+
+class MicrostructureReader;
+
+/**
+ * Initializes an elemental variable with the voxel data of a binary microstructure file
+ * (phase, feature id or one of the Euler angles), the counterpart of EBSDReaderPointDataAux
+ * for MicrostructureReader.
+ */
+class MicrostructureDataIC : public InitialCondition
+{
+public:
+  static InputParameters validParams();
+
+  MicrostructureDataIC(const InputParameters & parameters);
+
+  virtual Real value(const Point & p) override;
+
+protected:
+  const MicrostructureReader & _reader;
+
+  /// Voxel data to set
+  const MooseEnum _data_name;
+};
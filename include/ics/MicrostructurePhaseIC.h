@@ -0,0 +1,35 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "InitialCondition.h"
+
+class MicrostructureReader;
+
+/**
+ * Initializes an order parameter from a binary microstructure file, the counterpart of
+ * ReconPhaseVarIC for MicrostructureReader. At nodes the value is the fraction of the
+ * surrounding voxels belonging to the phase.
+ */
+class MicrostructurePhaseIC : public InitialCondition
+{
+public:
+  static InputParameters validParams();
+
+  MicrostructurePhaseIC(const InputParameters & parameters);
+
+  virtual Real value(const Point & p) override;
+
+protected:
+  const MicrostructureReader & _reader;
+
+  /// Phase id to initialize
+  const int _phase;
+};
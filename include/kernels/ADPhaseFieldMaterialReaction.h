@@ -0,0 +1,31 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ADKernel.h"
+
+/**
+ * AD version of PhaseFieldMaterialReaction. Adds \f$ -K \f$ to the residual of u, where
+ * \f$ K \f$ is an AD material property; all Jacobian blocks follow from automatic
+ * differentiation, so no derivative properties or args are needed.
+ */
+class ADPhaseFieldMaterialReaction : public ADKernel
+{
+public:
+  static InputParameters validParams();
+
+  ADPhaseFieldMaterialReaction(const InputParameters & parameters);
+
+protected:
+  virtual ADReal computeQpResidual() override;
+
+  /// Material property expression
+  const ADMaterialProperty<Real> & _K;
+};
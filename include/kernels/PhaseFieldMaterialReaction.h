@@ -24,6 +24,9 @@
 /**
  * This kernel adds to the residual of the variable u a contribution of
  * \f$ -K \f$ where \f$ K \f$ is a material property expression that can take any arguments.
+ * Every Jacobian block is the rank-1 form \f$ -\partial K \, \psi_i \phi_j \f$, so the element
+ * residual and Jacobian blocks are assembled directly as weighted outer products instead of
+ * through the per (i, j, qp) computeQp* calls.
  */
 class PhaseFieldMaterialReaction : public DerivativeMaterialInterface<JvarMapKernelInterface<Kernel>>
 {
@@ -33,10 +36,12 @@ public:
   PhaseFieldMaterialReaction(const InputParameters & parameters);
   virtual void initialSetup();
 
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
 protected:
   virtual Real computeQpResidual();
-  virtual Real computeQpJacobian();
-  virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
   /// Material property expression
   const MaterialProperty<Real> & _K;
@@ -49,6 +54,13 @@ protected:
 
   ///  Material property derivative w.r.t. other coupled variables in args
   std::vector<const MaterialProperty<Real> *> _dKdarg;
+
+  /// Add the block -dK * test_i * phi_j to the local matrix
+  void addRankOneBlock(const MaterialProperty<Real> & dK, unsigned int n_phi);
+
+  /// Quadrature weights of the current block and scratch space of the outer product
+  std::vector<Real> _qp_weight;
+  std::vector<Real> _weighted_test;
 };
 
 #endif // PHASEFIELDMATERIALREACTION
@@ -0,0 +1,111 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Material.h"
+#include "DerivativeMaterialInterface.h"
+#include "GrandPotentialSpecies.h"
+
+#include <array>
+
+/**
+ * Compiled grand potential material set for the carbon oxidation models with N phases and
+ * M species. For every species s and phase p it computes, in a single pass per quadrature
+ * point and with analytical first and second derivatives,
+ *
+ *   omega_p  = sum_s omega_ps(w_s)                    phase grand potential densities
+ *   omega    = sum_p h_p omega_p                       total grand potential density
+ *   rho_s_p  = -d(omega_ps)/dw_s                       phase number densities
+ *   rho_s    = sum_p h_p rho_s_p                       number densities
+ *   x_s      = Va rho_s                                site fractions (value only)
+ *   chi_s    = sum_p h_p d(rho_s_p)/dw_s               susceptibilities
+ *   D_s      = sum_p h_p D_sp                          diffusivities
+ *   Dchi_s   = D_s chi_s                               mobilities
+ *
+ * replacing the equivalent set of DerivativeParsedMaterials.
+ */
+template <unsigned int N, unsigned int M>
+class GrandPotentialOxidationMaterialTempl : public DerivativeMaterialInterface<Material>
+{
+public:
+  static InputParameters validParams();
+
+  GrandPotentialOxidationMaterialTempl(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  /// Property of the form sum_p h_p f_p(w_s) with all derivatives up to second order
+  struct MixedProperty
+  {
+    MaterialProperty<Real> * value;
+    MaterialProperty<Real> * dw;
+    MaterialProperty<Real> * dw2;
+    std::array<MaterialProperty<Real> *, N> deta;
+    std::array<MaterialProperty<Real> *, N> dwdeta;
+    std::array<std::array<MaterialProperty<Real> *, N>, N> deta2;
+  };
+
+  /// Declare a mixed property and its derivatives w.r.t. w_s and the order parameters
+  void declareMixedProperty(MixedProperty & prop, const std::string & name, unsigned int s);
+
+  /// Compute a mixed property from the phase values f[p] = {f, df/dw, d2f/dw2}
+  void computeMixedProperty(MixedProperty & prop, const std::array<std::array<Real, 3>, N> & f);
+
+  /// Chemical potential names and values
+  std::array<VariableName, M> _w_names;
+  std::array<const VariableValue *, M> _w;
+
+  /// Order parameter names
+  std::array<VariableName, N> _eta_names;
+
+  /// Switching functions and their derivatives
+  std::array<const MaterialProperty<Real> *, N> _h;
+  std::array<std::array<const MaterialProperty<Real> *, N>, N> _dh;
+  std::array<std::array<std::array<const MaterialProperty<Real> *, N>, N>, N> _d2h;
+
+  /// Free energy model of each phase (first index) and species (second index)
+  std::array<std::array<GrandPotentialSpecies::Parameters, M>, N> _model;
+
+  /// Diffusivity of each species in each phase
+  std::array<std::array<Real, N>, M> _diffusivity;
+
+  /// Thermal energy and atomic volume
+  const Real _kT;
+  const Real _Va;
+
+  /// Phase grand potential densities
+  std::array<MaterialProperty<Real> *, N> _omega_p;
+  std::array<std::array<MaterialProperty<Real> *, M>, N> _domega_p;
+  std::array<std::array<MaterialProperty<Real> *, M>, N> _d2omega_p;
+
+  /// Total grand potential density
+  MaterialProperty<Real> & _omega;
+  std::array<MaterialProperty<Real> *, M> _domega_dw;
+  std::array<MaterialProperty<Real> *, N> _domega_deta;
+  std::array<MaterialProperty<Real> *, M> _d2omega_dw2;
+  std::array<std::array<MaterialProperty<Real> *, N>, M> _d2omega_dwdeta;
+  std::array<std::array<MaterialProperty<Real> *, N>, N> _d2omega_deta2;
+
+  /// Phase number densities
+  std::array<std::array<MaterialProperty<Real> *, N>, M> _rho_p;
+  std::array<std::array<MaterialProperty<Real> *, N>, M> _drho_p;
+  std::array<std::array<MaterialProperty<Real> *, N>, M> _d2rho_p;
+
+  /// Number densities, susceptibilities, diffusivities and mobilities
+  std::array<MixedProperty, M> _rho;
+  std::array<MaterialProperty<Real> *, M> _x;
+  std::array<MixedProperty, M> _chi;
+  std::array<MixedProperty, M> _D;
+  std::array<MixedProperty, M> _Dchi;
+};
+
+typedef GrandPotentialOxidationMaterialTempl<2, 3> GrandPotentialOxidation2PhaseMaterial;
+typedef GrandPotentialOxidationMaterialTempl<3, 3> GrandPotentialOxidation3PhaseMaterial;
@@ -9,8 +9,7 @@
 
 #pragma once
 
-#include "Material.h"
-#include "DerivativeMaterialInterface.h"
+#include "StaticTensorMaterialBase.h"
 
 // Forward Declarations
 template <typename>
@@ -21,7 +20,7 @@ typedef RankTwoTensorTempl<Real> RankTwoTensor;
  * This material takes in a direction vector and rotates the coordinate system of a tensor
  * to align the original x-axis direction with the given vector.
  */
-class MobilityRotationVector : public DerivativeMaterialInterface<Material>
+class MobilityRotationVector : public StaticTensorMaterialBase
 {
 public:
   static InputParameters validParams();
@@ -29,9 +28,7 @@ public:
   MobilityRotationVector(const InputParameters & parameters);
 
 protected:
-  virtual void initQpStatefulProperties();
-
-  virtual void computeQpProperties();
+  virtual RealTensorValue computeQpTensor() override;
 
   Eigen::Quaternion<Real> axisAngleToQuaternion(RealVectorValue w, Real angle);
 
@@ -41,10 +38,6 @@ protected:
   // Phase A material properties
   const MaterialProperty<RealTensorValue> & _M_a;
 
-  // Global material properties
-  MaterialPropertyName _M_name;
-  MaterialProperty<RealTensorValue> & _M;
-
   // Direction vector
   const MaterialProperty<RealVectorValue> & _dir_vector;
 
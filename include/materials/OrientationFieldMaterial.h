@@ -0,0 +1,85 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "StaticTensorMaterialBase.h"
+#include "OrientationFieldFile.h"
+
+#include <mutex>
+
+class KDTree;
+
+/**
+ * This material reads an orientation field written by OrientationFieldWriter and
+ * assembles it directly into a RealTensorValue property. Elements are matched by id;
+ * if the id is missing or the centroid does not match (different mesh), the record
+ * with the closest centroid is used instead. Refined elements use the record of their
+ * closest stored ancestor. The file is read once per process and the table is shared by the
+ * threaded copies of the material.
+ */
+class OrientationFieldMaterial : public StaticTensorMaterialBase
+{
+public:
+  static InputParameters validParams();
+
+  OrientationFieldMaterial(const InputParameters & parameters);
+  virtual ~OrientationFieldMaterial();
+
+  virtual void initialSetup() override;
+
+protected:
+  /// Orientation field data, loaded once per process and shared by the threaded copies
+  struct Table
+  {
+    OrientationFieldFile::Data data;
+
+    /// Number of stored values per record
+    unsigned int n_values = 0;
+
+    /// Spatial search tree for the fallback lookup (built on first use)
+    std::unique_ptr<KDTree> kd_tree;
+    std::once_flag kd_tree_built;
+  };
+
+  virtual RealTensorValue computeQpTensor() override;
+
+  /// Read the file and drop the records of the elements this processor does not evaluate
+  std::shared_ptr<Table> loadTable() const;
+
+  /// Find the record of an element, returns the record index
+  std::size_t findRecord(const Elem * elem) const;
+
+  /// Index of the record matching the id and centroid of the element or of one of its
+  /// ancestors (or _invalid_record)
+  std::size_t findRecordById(const Table & table, const Elem * elem) const;
+
+  /// Index of the record with the closest centroid
+  std::size_t findRecordByPosition(const Point & p) const;
+
+  /// Name of the orientation field file
+  const FileName & _file_name;
+
+  /// Scale factor
+  const Real _scale;
+
+  /// Relative centroid tolerance (with respect to the element size) for an id match
+  const Real _position_tol;
+
+  /// Drop the records of elements that are not present on this processor
+  const bool _prune;
+
+  /// Orientation field table shared with the other copies of this material
+  std::shared_ptr<Table> _table;
+
+  /// Tensor of the current element
+  RealTensorValue _elem_tensor;
+
+  static const std::size_t _invalid_record;
+};
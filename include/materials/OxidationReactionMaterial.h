@@ -0,0 +1,70 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Material.h"
+#include "DerivativeMaterialInterface.h"
+
+/**
+ * Compiled reaction rate material for the carbon oxidation reaction C + O -> CO.
+ * Computes prop_i = coef_i * K(T) * rho_a * rho_b, with the Arrhenius rate
+ * K(T) = K_pre / int_width * exp(-Q / (k_Boltz T)), for a list of properties
+ * (production, consumption, reaction energy) in one pass, including the analytical
+ * first and second derivatives w.r.t. all coupled variables. The rate is zero when
+ * either number density is below the tolerance.
+ */
+class OxidationReactionMaterial : public DerivativeMaterialInterface<Material>
+{
+public:
+  static InputParameters validParams();
+
+  OxidationReactionMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  /// Number densities of the reactants and their derivatives
+  const MaterialProperty<Real> & _rho_a;
+  const MaterialProperty<Real> & _rho_b;
+  std::vector<const MaterialProperty<Real> *> _drho_a;
+  std::vector<const MaterialProperty<Real> *> _drho_b;
+  std::vector<std::vector<const MaterialProperty<Real> *>> _d2rho_a;
+  std::vector<std::vector<const MaterialProperty<Real> *>> _d2rho_b;
+
+  /// Temperature
+  const VariableValue & _T;
+
+  /// Index of the temperature in the coupled variables
+  unsigned int _T_index;
+
+  /// Arrhenius parameters
+  const Real _K_pre;
+  const Real _Q;
+  const Real _k_Boltz;
+  const Real _int_width;
+
+  /// Number density tolerance
+  const Real _tol;
+
+  /// Coefficients of the generated properties
+  const std::vector<Real> _coef;
+
+  /// Number of coupled variables
+  const unsigned int _nargs;
+
+  /// Generated properties and their derivatives
+  std::vector<MaterialProperty<Real> *> _prop;
+  std::vector<std::vector<MaterialProperty<Real> *>> _dprop;
+  std::vector<std::vector<std::vector<MaterialProperty<Real> *>>> _d2prop;
+
+  /// Rate derivatives at the current quadrature point (reused between the properties)
+  std::vector<Real> _df;
+  std::vector<std::vector<Real>> _d2f;
+};
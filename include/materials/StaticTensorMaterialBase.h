@@ -0,0 +1,83 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Material.h"
+#include "DerivativeMaterialInterface.h"
+#include "MeshChangedInterface.h"
+
+#include <unordered_map>
+
+/**
+ * Base class for materials that generate a RealTensorValue property which does not change
+ * after initialization (e.g. fiber orientation tensors). With static_tensor = true the tensor
+ * is computed once per element and quadrature point, stored in a per-element cache and copied
+ * from there in every later residual/Jacobian evaluation. The cache is only invalidated when
+ * the mesh changes (adaptivity, repartitioning) or when invalidateCache() is called.
+ */
+class StaticTensorMaterialBase : public DerivativeMaterialInterface<Material>,
+                                 public MeshChangedInterface
+{
+public:
+  static InputParameters validParams();
+
+  StaticTensorMaterialBase(const InputParameters & parameters);
+
+  virtual void computeProperties() override;
+
+  virtual void meshChanged() override;
+
+  /// Drop all cached tensors, they are recomputed on the next evaluation
+  void invalidateCache();
+
+  /// Number of elements currently stored in the cache of this thread
+  std::size_t cachedElements() const { return _cache_entries.size(); }
+
+  /// Approximate memory (in bytes) held by the cache of this thread
+  std::size_t cacheMemory() const;
+
+protected:
+  virtual void initQpStatefulProperties() override;
+
+  virtual void computeQpProperties() override;
+
+  /// Compute the tensor at the current quadrature point
+  virtual RealTensorValue computeQpTensor() = 0;
+
+  // Global material properties
+  MaterialPropertyName _M_name;
+  MaterialProperty<RealTensorValue> & _M;
+
+  /// Whether the tensor is computed once and then served from the cache
+  const bool _static;
+
+  /// Location of the tensors of one element in _cache_data
+  struct CacheEntry
+  {
+    /// Offset of the first quadrature point
+    std::size_t offset;
+    /// Number of quadrature points the tensors were computed with
+    unsigned int nqp;
+    /// Number of tensors reserved for the element
+    unsigned int capacity;
+  };
+
+  /// Rebuild _cache_data with only the tensors referenced by the entries
+  void compactCache();
+
+  /// Cache entry of each element
+  std::unordered_map<dof_id_type, CacheEntry> _cache_entries;
+
+  /// Contiguous storage of the cached tensors (element after element)
+  std::vector<RealTensorValue> _cache_data;
+
+  /// Number of tensors in _cache_data that are no longer referenced by an entry
+  std::size_t _cache_unused;
+};
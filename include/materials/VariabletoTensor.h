@@ -9,8 +9,7 @@
 
 #pragma once
 
-#include "Material.h"
-#include "DerivativeMaterialInterface.h"
+#include "StaticTensorMaterialBase.h"
 
 // Forward Declarations
 template <typename>
@@ -20,9 +19,10 @@ typedef RankTwoTensorTempl<Real> RankTwoTensor;
 /**
  * This material assembles a RealTensor material property
  * by reading 9 variables. It is useful to transfer a tensor from
- * another simulation.
+ * another simulation. Since the transferred tensor does not change, it
+ * can be cached with static_tensor = true.
  */
-class VariabletoTensor : public DerivativeMaterialInterface<Material>
+class VariabletoTensor : public StaticTensorMaterialBase
 {
 public:
   static InputParameters validParams();
@@ -30,9 +30,7 @@ public:
   VariabletoTensor(const InputParameters & parameters);
 
 protected:
-  virtual void initQpStatefulProperties();
-
-  virtual void computeQpProperties();
+  virtual RealTensorValue computeQpTensor() override;
 
   // Variables
   const VariableValue & _var_xx;
@@ -47,9 +45,4 @@ protected:
 
   // Scale factor
   const Real _scale;
-
-  // Global material properties
-  MaterialPropertyName _M_name;
-  MaterialProperty<RealTensorValue> & _M;
-
 };
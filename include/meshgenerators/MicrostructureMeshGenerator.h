@@ -0,0 +1,42 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MeshGenerator.h"
+
+/**
+ * Generates the regular voxel mesh of a binary microstructure file. Only the fixed size
+ * header of the file is read. With a distributed mesh every process only builds its slab of
+ * element layers along the last axis (plus one ghost layer), so the startup memory and time
+ * scale with the local partition. A replicated mesh holds the full grid on every process.
+ */
+class MicrostructureMeshGenerator : public MeshGenerator
+{
+public:
+  static InputParameters validParams();
+
+  MicrostructureMeshGenerator(const InputParameters & parameters);
+
+  std::unique_ptr<MeshBase> generate() override;
+
+protected:
+  /// Build the local slab of the grid with n elements per direction on a distributed mesh
+  void buildLocalSlab(MeshBase & mesh,
+                      unsigned int dim,
+                      const std::array<unsigned int, 3> & n,
+                      const std::array<Real, 3> & min,
+                      const std::array<Real, 3> & max) const;
+
+  /// Binary microstructure file
+  const FileName & _filename;
+
+  /// Number of uniform refinements the voxel grid is coarsened by before meshing
+  const unsigned int _pre_refine;
+};
@@ -0,0 +1,111 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "FileOutput.h"
+#include "AsyncFileWriter.h"
+
+namespace libMesh
+{
+class System;
+}
+
+/**
+ * Field output for long runs, readable by ParaView/VisIt as XDMF with raw binary heavy data.
+ * Every process appends its local mesh and fields to its own binary file and the root
+ * process appends the XML description of each output step to the .xmf file.
+ *
+ * The mesh and the static_variables (fields that do not change after initialization, such
+ * as the transferred conductivity tensor components) are written once per mesh and all
+ * later steps reference the same bytes; only the time-evolving variables are written every
+ * step. Values can be stored in single precision, and the file I/O runs on a background
+ * thread so the solver continues while the previous step is written.
+ */
+class StaticAwareXDMF : public FileOutput
+{
+public:
+  static InputParameters validParams();
+
+  StaticAwareXDMF(const InputParameters & parameters);
+  virtual ~StaticAwareXDMF();
+
+  virtual std::string filename() override;
+
+  virtual void meshChanged() override;
+
+protected:
+  virtual void output() override;
+
+  /// Variable to output
+  struct Field
+  {
+    std::string name;
+    const libMesh::System * sys;
+    unsigned int number;
+    bool nodal;
+  };
+
+  /// Collect the output variables
+  void initFields();
+
+  /// Append the local nodes, topology and static fields to the buffer
+  void packStatic(std::vector<char> & buffer);
+
+  /// Append the values of the given fields to the buffer
+  void packFields(const std::vector<Field> & fields, std::vector<char> & buffer);
+
+  /// Append a value with the output precision
+  void packValue(Real value, std::vector<char> & buffer) const;
+
+  /// XML of one output step (root process)
+  std::string stepXML(Real time,
+                      const std::vector<uint64_t> & epoch_info,
+                      const std::vector<uint64_t> & step_offsets) const;
+
+  /// XML of one binary data item
+  std::string dataItem(const std::string & file,
+                       uint64_t seek,
+                       const std::string & dims,
+                       bool integer) const;
+
+  /// Output variables, static and time dependent
+  const std::vector<VariableName> * _variable_names;
+  const std::vector<VariableName> & _static_names;
+  std::vector<Field> _static_fields;
+  std::vector<Field> _fields;
+
+  /// Bytes per stored value (4 or 8)
+  const unsigned int _precision;
+
+  /// Background writer
+  AsyncFileWriter _writer;
+
+  /// Local output mesh: vertex nodes and active local elements
+  std::vector<const Node *> _nodes;
+  std::vector<const Elem *> _elems;
+  std::size_t _topology_size;
+
+  /// Whether the mesh (and thus the static data) needs to be written
+  bool _write_static;
+
+  /// Bytes written to the binary file of this process
+  uint64_t _offset;
+
+  /// Sizes and offset of the current static data of all processes (root process)
+  std::vector<uint64_t> _epoch_info;
+
+  /// Position of the closing tags in the .xmf file and number of steps (root process)
+  uint64_t _xml_footer_pos;
+  unsigned int _n_steps;
+
+  /// Base of the output file names and the binary file of this process
+  std::string _base;
+  std::string _binary_file;
+};
@@ -0,0 +1,36 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+class FusedIntegralUserObject;
+
+/**
+ * Reports one of the quantities computed by a FusedIntegralUserObject.
+ */
+class FusedIntegralValue : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  FusedIntegralValue(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual PostprocessorValue getValue() const override;
+
+protected:
+  const FusedIntegralUserObject & _uo;
+
+  /// Index of the quantity in the user object results
+  unsigned int _index;
+};
@@ -0,0 +1,42 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+/**
+ * Reports the memory used by the per-element cache of a StaticTensorMaterialBase
+ * material (summed over all threads and either summed or maximized over all processes).
+ */
+class StaticTensorCacheMemory : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  StaticTensorCacheMemory(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() const override;
+
+protected:
+  /// Name of the static tensor material to query
+  const MaterialName & _material_name;
+
+  /// Units of the reported value
+  const MooseEnum & _mem_units;
+
+  /// Sum over all processes or maximum of a single process
+  const MooseEnum & _value_type;
+
+  /// Memory used by the cache (bytes until finalize)
+  Real _value;
+};
@@ -0,0 +1,81 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementUserObject.h"
+
+#include "libmesh/dense_matrix.h"
+#include "libmesh/dense_vector.h"
+
+namespace libMesh
+{
+class LinearImplicitSystem;
+}
+
+/**
+ * Computes the artificial temperature fields used by FiberDirectionAF in-process. The
+ * temperature is split into an imposed linear field and a fluctuation,
+ * T_i = -g x_i + theta_i, with theta_i = 0 on the given boundaries. All directions share
+ * the same conductivity operator and only differ in the right-hand side, so the operator is
+ * assembled once and the (up to) three systems are solved with a single preconditioner
+ * setup. The resulting fields are written into the temp_x/temp_y/temp_z aux variables.
+ */
+class ArtificialHeatFluxSolve : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  ArtificialHeatFluxSolve(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+protected:
+  /// Copy the solution of one direction into its aux variable
+  void copyToAuxVariable(unsigned int direction);
+
+  /// Isotropic thermal conductivity used for the artificial heat flux
+  const MaterialProperty<Real> & _thcond;
+
+  /// Lower bound of the conductivity (keeps the operator regular in the gas phase)
+  const Real _min_thcond;
+
+  /// Magnitude of the imposed temperature gradient
+  const Real _gradient;
+
+  /// Linear solver settings
+  const Real _l_tol;
+  const unsigned int _l_max_its;
+
+  /// Number of artificial temperature fields (mesh dimension)
+  const unsigned int _dim;
+
+  /// Aux variables receiving the artificial temperatures
+  std::vector<MooseVariable *> _temp_vars;
+
+  /// Materials whose static tensor cache is cleared after the solve
+  const std::vector<MaterialName> _static_materials;
+
+  /// Shape function gradients of the temperature variables
+  const VariablePhiGradient & _grad_phi;
+
+  /// System holding the shared operator, the right-hand sides and the fluctuation
+  libMesh::LinearImplicitSystem * _sys;
+
+  /// Names of the right-hand side vectors in _sys
+  std::vector<std::string> _rhs_names;
+
+  /// Local operator and right-hand sides
+  DenseMatrix<Number> _local_ke;
+  std::vector<DenseVector<Number>> _local_re;
+  std::vector<dof_id_type> _dof_indices;
+};
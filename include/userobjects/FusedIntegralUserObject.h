@@ -0,0 +1,64 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementUserObject.h"
+
+/**
+ * Evaluates a list of material property and variable integrals (and the mesh volume) in a
+ * single element loop followed by a single vector reduction, instead of one loop and one
+ * reduction per ElementIntegralMaterialProperty/ElementIntegralVariablePostprocessor.
+ * Optionally the fiber elements are counted in the same loop: the elements in which the fiber
+ * order parameter exceeds a threshold at any quadrature point, and their volume. The count is
+ * recomputed from scratch in every execution.
+ * Individual results are reported with FusedIntegralValue postprocessors.
+ */
+class FusedIntegralUserObject : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  FusedIntegralUserObject(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+  /// Index of a quantity in the result vector
+  unsigned int getIndex(const std::string & name) const;
+
+  /// Value of a quantity after finalize()
+  Real getValue(unsigned int index) const { return _values[index]; }
+
+protected:
+  /// Material properties to integrate
+  std::vector<const MaterialProperty<Real> *> _mat_props;
+
+  /// Variables to integrate
+  std::vector<const VariableValue *> _vars;
+
+  /// Whether the mesh volume is computed
+  const bool _compute_volume;
+
+  /// Fiber order parameter of the element count (nullptr if disabled) and threshold
+  const VariableValue * _fiber_var;
+  const Real _fiber_threshold;
+
+  /// Names of the quantities, in the order of _values
+  std::vector<std::string> _names;
+
+  /// Offsets of the quantities in _values
+  unsigned int _volume_index;
+  unsigned int _fiber_index;
+
+  /// Partial (then reduced) results of all quantities
+  std::vector<Real> _values;
+};
@@ -0,0 +1,49 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "MicrostructureFile.h"
+
+/**
+ * Parallel loader of a binary microstructure file (see MicrostructureFile). Instead of every
+ * process parsing the complete EBSD text file, each process only maps the slab of voxel
+ * layers covering the bounding box of its local elements, so the startup time and memory
+ * scale with the local partition. Lookups outside the slab (e.g. after repartitioning) are
+ * still answered by reading the single voxel from the file.
+ */
+class MicrostructureReader : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  MicrostructureReader(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// Voxel data at a point
+  int getPhase(const Point & p) const;
+  unsigned int getFeature(const Point & p) const;
+  RealVectorValue getEulerAngles(const Point & p) const;
+
+  /// Fraction of the voxels around p (one sample per neighboring voxel corner) of a phase
+  Real getPhaseFraction(const Point & p, int phase) const;
+
+  /// The underlying file
+  const MicrostructureFile & file() const { return _file; }
+
+protected:
+  /// Binary microstructure file
+  MicrostructureFile _file;
+};
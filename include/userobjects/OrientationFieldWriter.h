@@ -0,0 +1,53 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementUserObject.h"
+#include "OrientationFieldFile.h"
+
+/**
+ * Writes the element averaged orientation tensor (e.g. from MobilityRotationVector) and,
+ * optionally, the fiber direction (e.g. from FiberDirectionAF) into a compact binary file
+ * keyed by element id. The file is read back by OrientationFieldMaterial.
+ */
+class OrientationFieldWriter : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  OrientationFieldWriter(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+protected:
+  /// Axis of a transversely isotropic tensor, used for elements without a fiber direction
+  RealVectorValue tensorAxis(const RealTensorValue & tensor) const;
+
+  /// Output file name
+  const FileName & _file_name;
+
+  /// Storage layout of the tensor
+  const OrientationFieldFile::Storage _storage;
+
+  /// Number of stored values per element
+  const unsigned int _n_values;
+
+  /// Tensor to write
+  const MaterialProperty<RealTensorValue> & _tensor;
+
+  /// Fiber direction (only used with DIRECTION storage)
+  const MaterialProperty<RealVectorValue> * const _direction;
+
+  /// Records collected on this processor
+  OrientationFieldFile::Data _data;
+};
@@ -0,0 +1,56 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * Runs file writing jobs in submission order on a background thread, so that outputs do not
+ * block the solver. At most max_pending jobs are queued; submitting more blocks until the
+ * writer catches up, which bounds the memory held by the buffered data. Errors thrown by a
+ * job are rethrown on the calling thread by the next submit() or flush(). Without a
+ * background thread the jobs run immediately.
+ */
+class AsyncFileWriter
+{
+public:
+  AsyncFileWriter(bool background, unsigned int max_pending);
+  ~AsyncFileWriter();
+
+  AsyncFileWriter(const AsyncFileWriter &) = delete;
+  AsyncFileWriter & operator=(const AsyncFileWriter &) = delete;
+
+  /// Queue a job (or run it if there is no background thread)
+  void submit(std::function<void()> job);
+
+  /// Wait until all queued jobs are done
+  void flush();
+
+protected:
+  void run();
+  void rethrow();
+
+  const bool _background;
+  const unsigned int _max_pending;
+
+  std::deque<std::function<void()>> _jobs;
+  bool _busy;
+  bool _stop;
+  std::exception_ptr _error;
+
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::thread _thread;
+};
@@ -0,0 +1,88 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <cmath>
+
+/**
+ * Grand potential density contribution of a single species in a single phase, as a function
+ * of its chemical potential w. The number density is rho = -d(omega)/dw and the
+ * susceptibility is chi = d(rho)/dw. Three forms are used by the Macaw oxidation models:
+ *
+ *  PARABOLIC : omega = -w^2/(2 Va^2 A) - w xeq/Va                (gas phase)
+ *  DILUTE    : omega = -kT/Va exp((w - E)/kT)                     (dilute species in the fiber)
+ *  SATURATED : omega = -w/Va - kT/Va exp(-(w + E)/kT)             (carbon with vacancies, E = Ef_v)
+ */
+namespace GrandPotentialSpecies
+{
+enum class Model
+{
+  PARABOLIC,
+  DILUTE,
+  SATURATED
+};
+
+struct Parameters
+{
+  Model model = Model::PARABOLIC;
+  /// Curvature of the parabolic free energy
+  Real A = 1.0;
+  /// Equilibrium fraction of the parabolic free energy
+  Real xeq = 0.0;
+  /// Formation energy of the exponential forms
+  Real E = 0.0;
+};
+
+/**
+ * Evaluate omega and its first four derivatives w.r.t. w in one pass
+ * (d[0] = omega, d[1] = -rho, d[2] = -chi, d[3] = -dchi/dw, d[4] = -d2chi/dw2)
+ */
+inline void
+evaluate(const Parameters & p, Real w, Real kT, Real Va, Real d[5])
+{
+  switch (p.model)
+  {
+    case Model::PARABOLIC:
+    {
+      const Real c = 1.0 / (Va * Va * p.A);
+      d[0] = -0.5 * c * w * w - w * p.xeq / Va;
+      d[1] = -c * w - p.xeq / Va;
+      d[2] = -c;
+      d[3] = 0.0;
+      d[4] = 0.0;
+      break;
+    }
+
+    case Model::DILUTE:
+    {
+      const Real e = std::exp((w - p.E) / kT) / Va;
+      d[0] = -kT * e;
+      d[1] = -e;
+      d[2] = -e / kT;
+      d[3] = -e / (kT * kT);
+      d[4] = -e / (kT * kT * kT);
+      break;
+    }
+
+    case Model::SATURATED:
+    {
+      const Real e = std::exp(-(w + p.E) / kT) / Va;
+      d[0] = -w / Va - kT * e;
+      d[1] = -1.0 / Va + e;
+      d[2] = -e / kT;
+      d[3] = e / (kT * kT);
+      d[4] = -e / (kT * kT * kT);
+      break;
+    }
+  }
+}
+}
@@ -0,0 +1,143 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/point.h"
+
+#include <array>
+#include <atomic>
+
+/**
+ * Memory-mappable binary voxel microstructure (replacement for the ASCII EBSD files).
+ * All values are little-endian. The file consists of a fixed 128 byte header
+ *
+ *   char[8] magic, uint32 version, uint32 flags, uint32 dim, uint32[3] voxel counts,
+ *   double[3] minimum corner, double[3] voxel size, uint32 number of phases,
+ *   uint32 byte order mark, zero padding
+ *
+ * followed by structure-of-arrays voxel data in x-fastest order:
+ *
+ *   int32[n] phase ids, int32[n] feature ids, float[3n] Euler angles (if HAS_ORIENTATION)
+ *
+ * Since the last axis (y in 2D, z in 3D) varies slowest, the voxels of any slab of layers
+ * along that axis are contiguous in every array, and a process only maps the pages of the
+ * slab covering its mesh partition. Voxels outside the mapped slab are read on demand.
+ */
+class MicrostructureFile
+{
+public:
+  /// Header flags
+  static const uint32_t HAS_ORIENTATION = 1;
+
+  /// Size of the fixed header in bytes
+  static const std::size_t header_size = 128;
+
+  struct Header
+  {
+    uint32_t dim = 3;
+    std::array<uint32_t, 3> n = {{1, 1, 1}};
+    std::array<double, 3> min = {{0.0, 0.0, 0.0}};
+    std::array<double, 3> step = {{1.0, 1.0, 1.0}};
+    uint32_t n_phases = 0;
+    bool has_orientation = false;
+
+    /// Total number of voxels
+    std::size_t nVoxels() const { return std::size_t(n[0]) * n[1] * n[2]; }
+    /// Axis along which the file is split into slabs
+    unsigned int slabAxis() const { return dim - 1; }
+    /// Number of voxels in one layer normal to the slab axis
+    std::size_t layerSize() const { return nVoxels() / n[slabAxis()]; }
+  };
+
+  /// Open a file and read its header, no voxel data is mapped yet
+  MicrostructureFile(const std::string & file_name);
+  ~MicrostructureFile();
+
+  MicrostructureFile(const MicrostructureFile &) = delete;
+  MicrostructureFile & operator=(const MicrostructureFile &) = delete;
+
+  /// Read only the header of a file
+  static Header readHeader(const std::string & file_name);
+
+  /// Write a complete file, euler may be empty if no orientation is stored
+  static void write(const std::string & file_name,
+                    const Header & header,
+                    const std::vector<int32_t> & phases,
+                    const std::vector<int32_t> & features,
+                    const std::vector<float> & euler);
+
+  const Header & header() const { return _header; }
+
+  /// Map the layers [first, last) along the slab axis, replacing any previous mapping
+  void mapSlab(unsigned int first, unsigned int last);
+
+  /// Map the layers touched by a bounding box (min, max), padded by one layer
+  void mapSlab(const Point & min, const Point & max);
+
+  /// First and last (exclusive) mapped layer
+  unsigned int firstLayer() const { return _first_layer; }
+  unsigned int lastLayer() const { return _last_layer; }
+
+  /// Bytes of voxel data currently mapped
+  std::size_t mappedBytes() const;
+
+  /// Number of voxel reads that fell outside the mapped slab
+  std::size_t unmappedReads() const { return _unmapped_reads.load(); }
+
+  /// Global index of the voxel containing p (clamped to the voxel grid)
+  std::size_t voxelIndex(const Point & p) const;
+
+  /// Voxel data by global voxel index
+  int32_t phase(std::size_t index) const;
+  int32_t feature(std::size_t index) const;
+  RealVectorValue eulerAngles(std::size_t index) const;
+
+protected:
+  struct Mapping
+  {
+    void * address = nullptr;
+    std::size_t length = 0;
+    /// Pointer to the first requested byte inside the (page aligned) mapping
+    const char * data = nullptr;
+  };
+
+  /// Map a byte range of the file
+  void mapRange(std::size_t offset, std::size_t length, Mapping & mapping);
+  void unmap(Mapping & mapping);
+
+  /// Copy a value of one of the arrays into buf, from the mapping or from the file
+  void readValue(const Mapping & mapping,
+                 std::size_t array_offset,
+                 std::size_t value_size,
+                 std::size_t index,
+                 void * buf) const;
+
+  /// Byte offsets of the arrays
+  std::size_t phaseOffset() const { return header_size; }
+  std::size_t featureOffset() const { return header_size + 4 * _header.nVoxels(); }
+  std::size_t eulerOffset() const { return header_size + 8 * _header.nVoxels(); }
+
+  const std::string _file_name;
+  Header _header;
+  int _fd;
+
+  Mapping _phase_map;
+  Mapping _feature_map;
+  Mapping _euler_map;
+
+  unsigned int _first_layer;
+  unsigned int _last_layer;
+  mutable std::atomic<std::size_t> _unmapped_reads;
+
+  static const char _magic[8];
+  static const uint32_t _version;
+  static const uint32_t _byte_order_mark;
+};
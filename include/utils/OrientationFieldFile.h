@@ -0,0 +1,67 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/point.h"
+#include "libmesh/tensor_value.h"
+
+/**
+ * Compact per-element binary storage of a (symmetric) orientation tensor field.
+ * The file consists of a header followed by one record per element, sorted by element id:
+ *
+ *   header : char[8] magic, uint32 version, uint32 storage, uint64 number of records
+ *   record : uint64 element id, double[3] element centroid, double[n] values
+ *
+ * With SYMMETRIC storage the 6 independent tensor components are written in Voigt order
+ * (xx yy zz yz xz xy). With DIRECTION storage the tensor is assumed transversely isotropic
+ * and is written as the unit fiber direction plus the axial and transverse values.
+ */
+class OrientationFieldFile
+{
+public:
+  enum class Storage : uint32_t
+  {
+    SYMMETRIC = 0,
+    DIRECTION = 1
+  };
+
+  /// Field data, ids are sorted and values hold nValues(storage) entries per record
+  struct Data
+  {
+    Storage storage = Storage::SYMMETRIC;
+    std::vector<dof_id_type> ids;
+    std::vector<Point> centroids;
+    std::vector<Real> values;
+  };
+
+  /// Number of stored values per record
+  static unsigned int nValues(Storage storage);
+
+  /// Write the field data to a binary file
+  static void write(const std::string & file_name, const Data & data);
+
+  /// Read the field data from a binary file
+  static void read(const std::string & file_name, Data & data);
+
+  /// Pack a tensor (and the unit fiber direction for DIRECTION storage) into the stored values,
+  /// a zero direction is an error for DIRECTION storage
+  static void pack(Storage storage,
+                   const RealTensorValue & tensor,
+                   const RealVectorValue & direction,
+                   Real * values);
+
+  /// Reassemble the tensor from the stored values
+  static RealTensorValue unpack(Storage storage, const Real * values);
+
+private:
+  static const char _magic[8];
+  static const uint32_t _version;
+};
@@ -0,0 +1,54 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <vector>
+
+namespace MacawAssembly
+{
+/**
+ * Adds the weighted outer product ke(i, j) += sum_qp test[i][qp] * w[qp] * phi[j][qp]
+ * of the test and shape functions to a local matrix. The weighted test function is formed
+ * once per row, so the innermost loop is a contiguous dot product over the quadrature
+ * points that the compiler can vectorize.
+ */
+template <typename Matrix, typename TestArray, typename PhiArray>
+inline void
+addWeightedOuterProduct(Matrix & ke,
+                        const TestArray & test,
+                        const PhiArray & phi,
+                        const std::vector<Real> & w,
+                        unsigned int n_test,
+                        unsigned int n_phi,
+                        std::vector<Real> & scratch)
+{
+  const unsigned int nqp = w.size();
+  scratch.resize(nqp);
+  Real * const wt = scratch.data();
+
+  for (unsigned int i = 0; i < n_test; ++i)
+  {
+    const Real * const test_i = test[i].data();
+    for (unsigned int qp = 0; qp < nqp; ++qp)
+      wt[qp] = w[qp] * test_i[qp];
+
+    for (unsigned int j = 0; j < n_phi; ++j)
+    {
+      const Real * const phi_j = phi[j].data();
+      Real sum = 0.0;
+      for (unsigned int qp = 0; qp < nqp; ++qp)
+        sum += wt[qp] * phi_j[qp];
+      ke(i, j) += sum;
+    }
+  }
+}
+}
@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""
+Convert an ASCII EBSD text file (as read by EBSDReader/EBSDMeshGenerator) into the Macaw
+binary microstructure format read by MicrostructureReader/MicrostructureMeshGenerator.
+
+The binary layout is documented in include/utils/MicrostructureFile.h. Voxels are stored in
+x-fastest order so that every slab along the last axis is contiguous in the file.
+
+Usage:
+    python3 ebsd_to_mcw.py FiberOxOB_3D_ebsd.txt FiberOxOB_3D.mcw [--orientation yes|no|auto]
+"""
+
+import argparse
+import array
+import math
+import struct
+import sys
+
+MAGIC = b'MCWMSTR\0'
+VERSION = 1
+HAS_ORIENTATION = 1
+BYTE_ORDER_MARK = 0x01020304
+HEADER_SIZE = 128
+
+
+def read_ebsd_header(lines):
+    """Parse the '# KEY: value' header lines of an EBSD file."""
+    header = {}
+    n_phases = 0
+    for line in lines:
+        if not line.startswith('#'):
+            break
+        entry = line[1:].strip()
+        if ':' not in entry:
+            continue
+        key, value = [s.strip() for s in entry.split(':', 1)]
+        if key.startswith('Phase '):
+            n_phases += 1
+        else:
+            header[key] = value
+    header['n_phases'] = n_phases
+    return header
+
+
+def write_mcw(mcw_file, dim, n, vmin, step, n_phases, phases, features, euler=None):
+    """
+    Write a binary microstructure file. phases and features are array('i') and euler an
+    array('f') of 3 angles per voxel (or None), all in x-fastest voxel order.
+    """
+    head = bytearray(HEADER_SIZE)
+    struct.pack_into('<8sIII3I3d3dII', head, 0, MAGIC, VERSION,
+                     HAS_ORIENTATION if euler is not None else 0, dim,
+                     *n, *vmin, *step, n_phases, BYTE_ORDER_MARK)
+
+    arrays = [phases, features] + ([euler] if euler is not None else [])
+    if sys.byteorder != 'little':
+        arrays = [array.array(a.typecode, a) for a in arrays]
+        for a in arrays:
+            a.byteswap()
+
+    with open(mcw_file, 'wb') as out:
+        out.write(head)
+        for a in arrays:
+            a.tofile(out)
+
+
+def convert(ebsd_file, mcw_file, orientation='auto'):
+    with open(ebsd_file) as f:
+        lines = f.readlines()
+
+    header = read_ebsd_header(lines)
+    axes = 'XYZ'
+    step = [float(header.get(a + '_STEP', 0)) for a in axes]
+    vmin = [float(header.get(a + '_MIN', 0)) for a in axes]
+    n = [int(float(header.get(a + '_DIM', 0))) for a in axes]
+    dim = 3 if n[2] > 0 else 2
+    if dim == 2:
+        n[2] = 1
+        step[2] = 0.0
+
+    n_voxels = n[0] * n[1] * n[2]
+    phases = array.array('i', [0]) * n_voxels
+    features = array.array('i', [0]) * n_voxels
+    euler = array.array('f', [0.0]) * (3 * n_voxels)
+    seen = bytearray(n_voxels)
+    max_phase = 0
+    has_angles = False
+
+    for line in lines:
+        if line.startswith('#') or not line.strip():
+            continue
+        cols = line.split()
+        angles = [float(c) for c in cols[0:3]]
+        coords = [float(c) for c in cols[3:6]]
+        feature = int(cols[6])
+        phase = int(cols[7])
+
+        index = 0
+        for d in reversed(range(dim)):
+            i = int(math.floor((coords[d] - vmin[d]) / step[d]))
+            i = min(max(i, 0), n[d] - 1)
+            index = index * n[d] + i
+
+        phases[index] = phase
+        features[index] = feature
+        euler[3 * index:3 * index + 3] = array.array('f', angles)
+        seen[index] = 1
+        max_phase = max(max_phase, phase)
+        has_angles = has_angles or any(a != 0.0 for a in angles)
+
+    missing = n_voxels - sum(seen)
+    if missing:
+        sys.exit('Error: {} voxels of the {} x {} x {} grid are missing in {}'.format(
+            missing, n[0], n[1], n[2], ebsd_file))
+
+    store_orientation = has_angles if orientation == 'auto' else orientation == 'yes'
+    n_phases = max(header['n_phases'], max_phase)
+
+    write_mcw(mcw_file, dim, n, vmin, step, n_phases, phases, features,
+              euler if store_orientation else None)
+
+    print('Wrote {} ({}D, {} x {} x {} voxels, {} phases, orientation {})'.format(
+        mcw_file, dim, n[0], n[1], n[2], n_phases, 'yes' if store_orientation else 'no'))
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('ebsd_file', help='ASCII EBSD input file')
+    parser.add_argument('mcw_file', help='Binary microstructure output file')
+    parser.add_argument('--orientation', choices=['yes', 'no', 'auto'], default='auto',
+                        help='Store the Euler angles (auto: only if any angle is non-zero)')
+    args = parser.parse_args()
+    convert(args.ebsd_file, args.mcw_file, args.orientation)
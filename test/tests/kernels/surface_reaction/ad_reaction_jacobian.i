@@ -0,0 +1,133 @@
+#------------------------------------------------------------------------------#
+# ADPhaseFieldMaterialReaction Jacobian
+# The reaction_jacobian.i problem with an AD reaction rate material. The
+# Jacobian of the reaction kernels follows from automatic differentiation and
+# is compared with a finite difference Jacobian.
+#------------------------------------------------------------------------------#
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 3
+    ny = 3
+    elem_type = QUAD9
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Variables]
+  [u]
+    order = SECOND
+  []
+  [v]
+    order = SECOND
+  []
+  [T]
+  []
+  [c]
+  []
+[]
+
+[ICs]
+  [u]
+    type = RandomIC
+    variable = u
+    min = 0.1
+    max = 0.9
+    seed = 1
+  []
+  [v]
+    type = RandomIC
+    variable = v
+    min = 0.1
+    max = 0.9
+    seed = 2
+  []
+  [T]
+    type = RandomIC
+    variable = T
+    min = 0.5
+    max = 1.5
+    seed = 3
+  []
+  [c]
+    type = RandomIC
+    variable = c
+    seed = 4
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Kernels]
+  [u_dot]
+    type = ADTimeDerivative
+    variable = u
+  []
+  [u_diff]
+    type = ADDiffusion
+    variable = u
+  []
+  [u_reaction]
+    type = ADPhaseFieldMaterialReaction
+    variable = u
+    mat_function = consumption
+  []
+
+  [v_dot]
+    type = ADTimeDerivative
+    variable = v
+  []
+  [v_diff]
+    type = ADDiffusion
+    variable = v
+  []
+  [v_reaction]
+    type = ADPhaseFieldMaterialReaction
+    variable = v
+    mat_function = consumption
+  []
+
+  [T_dot]
+    type = ADTimeDerivative
+    variable = T
+  []
+  [T_diff]
+    type = ADDiffusion
+    variable = T
+  []
+
+  [c_dot]
+    type = ADTimeDerivative
+    variable = c
+  []
+  [c_diff]
+    type = ADDiffusion
+    variable = c
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Materials]
+  [consumption]
+    type = ADParsedMaterial
+    property_name = consumption
+    coupled_variables = 'u v T'
+    expression = '-2*u^2*v*exp(-1/T)'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  num_steps = 1
+  dt = 0.1
+[]
@@ -0,0 +1,141 @@
+#------------------------------------------------------------------------------#
+# PhaseFieldMaterialReaction Jacobian
+# Two species react with a temperature dependent rate. The reaction kernels
+# assemble their on- and off-diagonal blocks as weighted outer products, which
+# are compared with a finite difference Jacobian. The variable c is not an
+# argument of the rate, so its blocks are requested by the full SMP but skipped
+# by the reaction kernels.
+#------------------------------------------------------------------------------#
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 3
+    ny = 3
+    elem_type = QUAD9
+  []
+[]
+
+[GlobalParams]
+  derivative_order = 2
+[]
+
+#------------------------------------------------------------------------------#
+[Variables]
+  [u]
+    order = SECOND
+  []
+  [v]
+    order = SECOND
+  []
+  [T]
+  []
+  [c]
+  []
+[]
+
+[ICs]
+  [u]
+    type = RandomIC
+    variable = u
+    min = 0.1
+    max = 0.9
+    seed = 1
+  []
+  [v]
+    type = RandomIC
+    variable = v
+    min = 0.1
+    max = 0.9
+    seed = 2
+  []
+  [T]
+    type = RandomIC
+    variable = T
+    min = 0.5
+    max = 1.5
+    seed = 3
+  []
+  [c]
+    type = RandomIC
+    variable = c
+    seed = 4
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Kernels]
+  [u_dot]
+    type = TimeDerivative
+    variable = u
+  []
+  [u_diff]
+    type = Diffusion
+    variable = u
+  []
+  [u_reaction]
+    type = PhaseFieldMaterialReaction
+    variable = u
+    mat_function = consumption
+    args = 'v T'
+  []
+
+  [v_dot]
+    type = TimeDerivative
+    variable = v
+  []
+  [v_diff]
+    type = Diffusion
+    variable = v
+  []
+  [v_reaction]
+    type = PhaseFieldMaterialReaction
+    variable = v
+    mat_function = consumption
+    args = 'u T'
+  []
+
+  [T_dot]
+    type = TimeDerivative
+    variable = T
+  []
+  [T_diff]
+    type = Diffusion
+    variable = T
+  []
+
+  [c_dot]
+    type = TimeDerivative
+    variable = c
+  []
+  [c_diff]
+    type = Diffusion
+    variable = c
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Materials]
+  [consumption]
+    type = DerivativeParsedMaterial
+    property_name = consumption
+    coupled_variables = 'u v T'
+    expression = '-2*u^2*v*exp(-1/T)'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  num_steps = 1
+  dt = 0.1
+[]
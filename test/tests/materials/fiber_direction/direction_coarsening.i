@@ -0,0 +1,310 @@
+#------------------------------------------------------------------------------#
+# Fiber direction and rotated tensor under refinement and coarsening
+# A refinement band follows the front x = 2 t across the mesh, so the elements
+# refined in one step are coarsened in the next. The artificial temperatures are
+# bilinear and survive both projections exactly. After every adaptivity step the
+# FiberDirectionAF direction and the static MobilityRotationVector tensor are
+# compared on every element with the analytic values,
+#   d = -(2 y + 2, 2 x + 1) / s,  s = |(2 y + 2, 2 x + 1)|,
+#   K = I + 9 a a^T with the rotated axis a = (d_x, -d_y),
+# and the run fails if they differ. The gold holds the number of active
+# elements: 88 while the first column is refined, then 112 with two refined
+# columns after the first column has been coarsened.
+#------------------------------------------------------------------------------#
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 8
+    ny = 8
+    xmax = 8
+    ymax = 8
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[AuxVariables]
+  [T_x]
+  []
+  [T_y]
+  []
+  [front]
+  []
+
+  [dir_x]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [dir_y]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [k_xx]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [k_xy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [k_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [ref_dir_x]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [ref_dir_y]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [ref_xx]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [ref_xy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [ref_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [error]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[ICs]
+  # Bilinear fields are represented exactly by the first order Lagrange basis
+  [IC_T_x]
+    type = FunctionIC
+    variable = T_x
+    function = 'x*y + 2*x'
+  []
+  [IC_T_y]
+    type = FunctionIC
+    variable = T_y
+    function = 'x*y + y'
+  []
+  [IC_front]
+    type = FunctionIC
+    variable = front
+    function = front
+  []
+[]
+
+[Functions]
+  [front]
+    type = ParsedFunction
+    expression = 'x - 2*t'
+  []
+  [ref_dir_x]
+    type = ParsedFunction
+    expression = '-(2*y + 2) / sqrt((2*y + 2)^2 + (2*x + 1)^2)'
+  []
+  [ref_dir_y]
+    type = ParsedFunction
+    expression = '-(2*x + 1) / sqrt((2*y + 2)^2 + (2*x + 1)^2)'
+  []
+  [ref_xx]
+    type = ParsedFunction
+    expression = '1 + 9 * (2*y + 2)^2 / ((2*y + 2)^2 + (2*x + 1)^2)'
+  []
+  [ref_xy]
+    type = ParsedFunction
+    expression = '-9 * (2*y + 2) * (2*x + 1) / ((2*y + 2)^2 + (2*x + 1)^2)'
+  []
+  [ref_yy]
+    type = ParsedFunction
+    expression = '1 + 9 * (2*x + 1)^2 / ((2*y + 2)^2 + (2*x + 1)^2)'
+  []
+[]
+
+[AuxKernels]
+  [front]
+    type = FunctionAux
+    variable = front
+    function = front
+    execute_on = 'TIMESTEP_END'
+  []
+
+  [dir_x]
+    type = MaterialRealVectorValueAux
+    property = fiber_direction
+    variable = dir_x
+    component = 0
+    execute_on = 'TIMESTEP_END'
+  []
+  [dir_y]
+    type = MaterialRealVectorValueAux
+    property = fiber_direction
+    variable = dir_y
+    component = 1
+    execute_on = 'TIMESTEP_END'
+  []
+  [k_xx]
+    type = MaterialRealTensorValueAux
+    property = rot_k
+    variable = k_xx
+    row = 0
+    column = 0
+    execute_on = 'TIMESTEP_END'
+  []
+  [k_xy]
+    type = MaterialRealTensorValueAux
+    property = rot_k
+    variable = k_xy
+    row = 0
+    column = 1
+    execute_on = 'TIMESTEP_END'
+  []
+  [k_yy]
+    type = MaterialRealTensorValueAux
+    property = rot_k
+    variable = k_yy
+    row = 1
+    column = 1
+    execute_on = 'TIMESTEP_END'
+  []
+
+  # Analytic values, averaged over the same quadrature points
+  [ref_dir_x]
+    type = FunctionAux
+    variable = ref_dir_x
+    function = ref_dir_x
+    execute_on = 'TIMESTEP_END'
+  []
+  [ref_dir_y]
+    type = FunctionAux
+    variable = ref_dir_y
+    function = ref_dir_y
+    execute_on = 'TIMESTEP_END'
+  []
+  [ref_xx]
+    type = FunctionAux
+    variable = ref_xx
+    function = ref_xx
+    execute_on = 'TIMESTEP_END'
+  []
+  [ref_xy]
+    type = FunctionAux
+    variable = ref_xy
+    function = ref_xy
+    execute_on = 'TIMESTEP_END'
+  []
+  [ref_yy]
+    type = FunctionAux
+    variable = ref_yy
+    function = ref_yy
+    execute_on = 'TIMESTEP_END'
+  []
+  [error]
+    type = ParsedAux
+    variable = error
+    coupled_variables = 'dir_x dir_y k_xx k_xy k_yy ref_dir_x ref_dir_y ref_xx ref_xy ref_yy'
+    expression = 'max(max(abs(dir_x - ref_dir_x), abs(dir_y - ref_dir_y)),
+                      max(max(abs(k_xx - ref_xx), abs(k_xy - ref_xy)), abs(k_yy - ref_yy)))'
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Materials]
+  [k_AF]
+    type = GenericConstantMaterial
+    prop_names = 'k_AF'
+    prop_values = '1'
+  []
+  [direction]
+    type = FiberDirectionAF
+    temp_x = T_x
+    temp_y = T_y
+    thermal_conductivity = k_AF
+    vector_name = fiber_direction
+    correct_negative_directions = false
+  []
+  [k_f]
+    type = ConstantAnisotropicMobility
+    tensor = '10 0 0
+              0  1 0
+              0  0 1'
+    M_name = k_f
+  []
+  [rotation]
+    type = MobilityRotationVector
+    M_A = k_f
+    direction_vector = fiber_direction
+    M_name = rot_k
+    static_tensor = true
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Adaptivity]
+  # Refine the columns with a quadrature point within one element of the front
+  marker = band
+  initial_marker = band
+  initial_steps = 1
+  max_h_level = 1
+  [Markers]
+    [band]
+      type = ValueRangeMarker
+      variable = front
+      lower_bound = -1
+      upper_bound = 1
+    []
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[UserObjects]
+  [check]
+    type = Terminator
+    expression = 'max_error > 1e-10'
+    fail_mode = HARD
+    error_level = ERROR
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Postprocessors]
+  [n_elements]
+    type = NumElements
+    elem_filter = active
+    execute_on = 'TIMESTEP_END'
+  []
+  [max_error]
+    type = ElementExtremeValue
+    variable = error
+    execute_on = 'TIMESTEP_END'
+    outputs = none
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+
+  [Quadrature]
+    type = GAUSS
+    order = SECOND
+  []
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    file_base = direction_coarsening_out
+    execute_on = 'TIMESTEP_END'
+  []
+[]
@@ -0,0 +1,263 @@
+#------------------------------------------------------------------------------#
+# Orientation Field Transfer with adaptivity
+# Nondimensional parameters with convertion factors:
+# lo = 2.1524e-04 micron
+# to = 4.3299e-04 s
+# eo = 3.9 eV
+# This file reads the rotated fiber thermal conductivity tensor written by
+# OrientationFieldWriter and refines the mesh around the fiber interface.
+# Refined elements take the tensor of the element of the original mesh they
+# were created from, and get it back unchanged when they are coarsened. The
+# tensor is compared on every active element with the rot_thcond_f field of
+# the writer run on the original mesh, and the run fails if they differ.
+#------------------------------------------------------------------------------#
+
+#------------------------------------------------------------------------------#
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+
+    xmin = 0
+    xmax = 557280 # 120 microns
+    nx = 12
+
+    ymin = 0
+    ymax = 557280 # 120 microns
+    ny = 12
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Variables]
+  [T]
+    initial_condition = 3000
+  []
+[]
+
+[AuxVariables]
+  [eta_f]
+  []
+
+  [k_00]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [k_01]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [k_11]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [ref_00]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [ref_01]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [ref_11]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [orientation_error]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+#------------------------------------------------------------------------------#
+# Tensor of the writer run on the original 12x12 mesh. Evaluated at the
+# element centroid, a refined child reads the value of its parent.
+[UserObjects]
+  [writer_solution]
+    type = SolutionUserObject
+    mesh = gold/th_cond_tensor_rotation_exodus.e
+    system_variables = 'rot_thcond_f_00 rot_thcond_f_01 rot_thcond_f_11'
+    timestep = 'LATEST'
+  []
+  [check_orientation]
+    type = Terminator
+    expression = 'max_orientation_error > 1e-8 | n_elements <= 144'
+    fail_mode = HARD
+    error_level = ERROR
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[Functions]
+  [ic_func_eta_f]
+    type = ParsedFunction
+    expression = '0.5*(1.0-tanh(2*(abs(x-278640)-r)/int_width))'
+    symbol_names = 'int_width r'
+    symbol_values = '23220     92880' # fiber radius 20 microns
+  []
+[]
+
+[ICs]
+  [IC_eta_f]
+    type = FunctionIC
+    variable = eta_f
+    function = ic_func_eta_f
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[AuxKernels]
+  [k_00]
+    type = MaterialRealTensorValueAux
+    property = thcond_f
+    variable = k_00
+    row = 0
+    column = 0
+    execute_on = 'TIMESTEP_END'
+  []
+  [k_01]
+    type = MaterialRealTensorValueAux
+    property = thcond_f
+    variable = k_01
+    row = 0
+    column = 1
+    execute_on = 'TIMESTEP_END'
+  []
+  [k_11]
+    type = MaterialRealTensorValueAux
+    property = thcond_f
+    variable = k_11
+    row = 1
+    column = 1
+    execute_on = 'TIMESTEP_END'
+  []
+  [ref_00]
+    type = SolutionAux
+    solution = writer_solution
+    from_variable = rot_thcond_f_00
+    variable = ref_00
+    execute_on = 'TIMESTEP_END'
+  []
+  [ref_01]
+    type = SolutionAux
+    solution = writer_solution
+    from_variable = rot_thcond_f_01
+    variable = ref_01
+    execute_on = 'TIMESTEP_END'
+  []
+  [ref_11]
+    type = SolutionAux
+    solution = writer_solution
+    from_variable = rot_thcond_f_11
+    variable = ref_11
+    execute_on = 'TIMESTEP_END'
+  []
+  [orientation_error]
+    type = ParsedAux
+    variable = orientation_error
+    coupled_variables = 'k_00 k_01 k_11 ref_00 ref_01 ref_11'
+    expression = '(abs(k_00 - ref_00) + 2*abs(k_01 - ref_01) + abs(k_11 - ref_11))
+                  / (abs(ref_00) + abs(ref_11))'
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Kernels]
+  #----------------------------------------------------------------------------#
+  # Heat Conduction kernels
+  [Heat_Conduction]
+    type = MatAnisoDiffusion
+    variable = T
+    diffusivity = thcond_f
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Materials]
+  #----------------------------------------------------------------------------#
+  # Generates a th cond tensor (RealTensorValue) from the orientation field file
+  [thcond_f]
+    type = OrientationFieldMaterial
+    file = orientation_field_symmetric.bin
+    static_tensor = true
+
+    M_name = thcond_f
+
+    outputs = exodus
+    output_properties = thcond_f
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Adaptivity]
+  # Band of one interface width around the fiber, |1 - 2 eta_f| < tanh(2),
+  # coarsened beyond two widths, |1 - 2 eta_f| > tanh(4)
+  marker = band
+  initial_marker = band
+  initial_steps = 1
+  max_h_level = 1
+  [Markers]
+    [band]
+      type = ValueRangeMarker
+      variable = eta_f
+      lower_bound = ${fparse 0.5 * (1 - tanh(2 * 1))}
+      upper_bound = ${fparse 0.5 * (1 + tanh(2 * 1))}
+      buffer_size = ${fparse 0.5 * (tanh(2 * 2) - tanh(2 * 1))}
+      third_state = DO_NOTHING
+    []
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[BCs]
+  [fixed_T_top]
+    type = DirichletBC
+    variable = 'T'
+    boundary = 'top'
+    value = '3000'
+  []
+  [fixed_T_bottom]
+    type = DirichletBC
+    variable = 'T'
+    boundary = 'bottom'
+    value = '2988'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Postprocessors]
+  [n_elements]
+    type = NumElements
+    elem_filter = active
+    execute_on = 'TIMESTEP_END'
+  []
+  [max_orientation_error]
+    type = ElementExtremeValue
+    variable = orientation_error
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Executioner]
+  type = Transient
+
+  nl_rel_tol = 1.0e-8
+  nl_abs_tol = 1e-10
+
+  start_time = 0.0
+  dt = 1
+  num_steps = 2
+
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+#------------------------------------------------------------------------------#
+[Outputs]
+  [exodus]
+    type = Exodus
+  []
+[]
@@ -0,0 +1,99 @@
+#------------------------------------------------------------------------------#
+# Orientation Field Transfer
+# Nondimensional parameters with convertion factors:
+# lo = 2.1524e-04 micron
+# to = 4.3299e-04 s
+# eo = 3.9 eV
+# This file reads the rotated fiber thermal conductivity tensor written by
+# OrientationFieldWriter (see the tests file) directly into a tensor material
+# property, without a SolutionUserObject or intermediate aux variables.
+#------------------------------------------------------------------------------#
+
+#------------------------------------------------------------------------------#
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+
+    xmin = 0
+    xmax = 557280 # 120 microns
+    nx = 12
+
+    ymin = 0
+    ymax = 557280 # 120 microns
+    ny = 12
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Variables]
+  [T]
+    initial_condition = 3000
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Kernels]
+  #----------------------------------------------------------------------------#
+  # Heat Conduction kernels
+  [Heat_Conduction]
+    type = MatAnisoDiffusion
+    variable = T
+    diffusivity = thcond_f
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Materials]
+  #----------------------------------------------------------------------------#
+  # Generates a th cond tensor (RealTensorValue) from the orientation field file
+  [thcond_f]
+    type = OrientationFieldMaterial
+    file = orientation_field_symmetric.bin
+    static_tensor = true
+
+    M_name = thcond_f
+
+    outputs = exodus
+    output_properties = thcond_f
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[BCs]
+  [fixed_T_top]
+    type = DirichletBC
+    variable = 'T'
+    boundary = 'top'
+    value = '3000'
+  []
+  [fixed_T_bottom]
+    type = DirichletBC
+    variable = 'T'
+    boundary = 'bottom'
+    value = '2988'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Executioner]
+  type = Transient
+
+  nl_rel_tol = 1.0e-8
+  nl_abs_tol = 1e-10
+
+  start_time = 0.0
+  dt = 1
+  num_steps = 1
+
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+#------------------------------------------------------------------------------#
+[Outputs]
+  [exodus]
+    type = Exodus
+  []
+[]
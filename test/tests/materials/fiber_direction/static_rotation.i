@@ -0,0 +1,253 @@
+#------------------------------------------------------------------------------#
+# Static rotated tensor
+# The artificial temperatures are fixed bilinear fields, so the fiber direction
+# and the rotated tensor do not change in time. The tensor is rotated once with
+# static_tensor = true and served from the cache in the following evaluations.
+# A second MobilityRotationVector without the cache must give the same tensor,
+# and the domain integrals of the direction and the tensor are compared with a
+# gold computed from the bilinear fields.
+#------------------------------------------------------------------------------#
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 5
+    ny = 5
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[AuxVariables]
+  [T_x]
+  []
+  [T_y]
+  []
+
+  [k_xx]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [k_xy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [k_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [dir_x]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [dir_y]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [ref_xx]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [ref_xy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [ref_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [error]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[ICs]
+  # Bilinear fields are represented exactly by the first order Lagrange basis
+  [IC_T_x]
+    type = FunctionIC
+    variable = T_x
+    function = 'x*y + 2*x'
+  []
+  [IC_T_y]
+    type = FunctionIC
+    variable = T_y
+    function = 'x*y + y'
+  []
+[]
+
+[AuxKernels]
+  [k_xx]
+    type = MaterialRealTensorValueAux
+    property = rot_k_static
+    variable = k_xx
+    row = 0
+    column = 0
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [k_xy]
+    type = MaterialRealTensorValueAux
+    property = rot_k_static
+    variable = k_xy
+    row = 0
+    column = 1
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [k_yy]
+    type = MaterialRealTensorValueAux
+    property = rot_k_static
+    variable = k_yy
+    row = 1
+    column = 1
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [dir_x]
+    type = MaterialRealVectorValueAux
+    property = fiber_direction
+    variable = dir_x
+    component = 0
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [dir_y]
+    type = MaterialRealVectorValueAux
+    property = fiber_direction
+    variable = dir_y
+    component = 1
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [ref_xx]
+    type = MaterialRealTensorValueAux
+    property = rot_k
+    variable = ref_xx
+    row = 0
+    column = 0
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [ref_xy]
+    type = MaterialRealTensorValueAux
+    property = rot_k
+    variable = ref_xy
+    row = 0
+    column = 1
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [ref_yy]
+    type = MaterialRealTensorValueAux
+    property = rot_k
+    variable = ref_yy
+    row = 1
+    column = 1
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  # Largest difference between the cached and the recomputed tensor
+  [error]
+    type = ParsedAux
+    variable = error
+    coupled_variables = 'k_xx k_xy k_yy ref_xx ref_xy ref_yy'
+    expression = 'max(max(abs(k_xx - ref_xx), abs(k_xy - ref_xy)), abs(k_yy - ref_yy))'
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Materials]
+  [k_AF]
+    type = GenericConstantMaterial
+    prop_names = 'k_AF'
+    prop_values = '1'
+  []
+  [direction]
+    type = FiberDirectionAF
+    temp_x = T_x
+    temp_y = T_y
+    thermal_conductivity = k_AF
+    vector_name = fiber_direction
+    correct_negative_directions = false
+  []
+  [k_f]
+    type = ConstantAnisotropicMobility
+    tensor = '10 0 0
+              0  1 0
+              0  0 1'
+    M_name = k_f
+  []
+
+  [rotation_static]
+    type = MobilityRotationVector
+    M_A = k_f
+    direction_vector = fiber_direction
+    M_name = rot_k_static
+    static_tensor = true
+  []
+  [rotation]
+    type = MobilityRotationVector
+    M_A = k_f
+    direction_vector = fiber_direction
+    M_name = rot_k
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[UserObjects]
+  [check]
+    type = Terminator
+    expression = 'max_error > 1e-12'
+    fail_mode = HARD
+    error_level = ERROR
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Postprocessors]
+  [int_k_xx]
+    type = ElementIntegralVariablePostprocessor
+    variable = k_xx
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_k_xy]
+    type = ElementIntegralVariablePostprocessor
+    variable = k_xy
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_k_yy]
+    type = ElementIntegralVariablePostprocessor
+    variable = k_yy
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_dir_x]
+    type = ElementIntegralVariablePostprocessor
+    variable = dir_x
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_dir_y]
+    type = ElementIntegralVariablePostprocessor
+    variable = dir_y
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [max_error]
+    type = ElementExtremeValue
+    variable = error
+    execute_on = 'INITIAL TIMESTEP_END'
+    outputs = none
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+
+  [Quadrature]
+    type = GAUSS
+    order = SECOND
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,447 @@
+#------------------------------------------------------------------------------#
+# Compiled Grand Potential Carbon Oxidation Materials
+# Nondimensional parameters with convertion factors:
+# lo = 2.1524e-04 micron
+# to = 4.3299e-04 s
+# eo = 3.9 eV
+# This file runs the C/O/CO grand potential oxidation model of step2 with the
+# compiled GrandPotentialOxidation2PhaseMaterial and OxidationReactionMaterial
+# instead of the DerivativeParsedMaterials for omega, rho, chi, D*chi and the
+# reaction rates. The reaction terms are applied with PhaseFieldMaterialReaction
+# as in the step2 inputs.
+#------------------------------------------------------------------------------#
+
+#------------------------------------------------------------------------------#
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+
+    xmin = 0
+    xmax = 139320 # 30 microns
+    nx = 15
+
+    ymin = 0
+    ymax = 139320 # 30 microns
+    ny = 15
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[GlobalParams]
+  # Interface thickness from Grand Potential material
+  width = 4644 # int_width 1 micron, half of the total width
+
+  # [Materials] stuff during initialization
+  derivative_order = 2
+  evalerror_behavior = error
+  enable_ad_cache = false
+  enable_jit = false
+[]
+
+#------------------------------------------------------------------------------#
+[Variables]
+  [w_c]
+  []
+  [w_o]
+  []
+  [w_co]
+  []
+  [eta_f]
+  []
+  [eta_g]
+  []
+  [T]
+    initial_condition = 3000
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[ICs]
+  [IC_eta_f]
+    type = BoundingBoxIC
+    variable = eta_f
+    x1 = 0
+    y1 = 0
+    x2 = 139320
+    y2 = 69660 # 15
+    inside = 1.0
+    outside = 0.0
+    int_width = 4644
+  []
+  [IC_eta_g]
+    type = BoundingBoxIC
+    variable = eta_g
+    x1 = 0
+    y1 = 0
+    x2 = 139320
+    y2 = 69660 # 15
+    inside = 0.0
+    outside = 1.0
+    int_width = 4644
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Kernels]
+  #----------------------------------------------------------------------------#
+  # Reaction kernels
+  [reaction_kernel_C]
+    type = PhaseFieldMaterialReaction
+    variable = w_c
+    mat_function = reaction_CO
+    args = 'w_o eta_f eta_g T'
+  []
+  [reaction_kernel_O]
+    type = PhaseFieldMaterialReaction
+    variable = w_o
+    mat_function = reaction_CO
+    args = 'w_c eta_f eta_g T'
+  []
+  [reaction_kernel_CO]
+    type = PhaseFieldMaterialReaction
+    variable = w_co
+    mat_function = production_CO
+    args = 'w_c w_o eta_f eta_g T'
+  []
+  [reaction_energy_CO]
+    type = PhaseFieldMaterialReaction
+    variable = T
+    mat_function = energy_CO
+    args = 'w_c w_o eta_f eta_g'
+  []
+
+  #----------------------------------------------------------------------------#
+  # eta_f kernels
+  [AC_f_bulk]
+    type = ACGrGrMulti
+    variable = eta_f
+    v = 'eta_g'
+    gamma_names = 'gamma_fg'
+    mob_name = L
+  []
+  [AC_f_sw]
+    type = ACSwitching
+    variable = eta_f
+    Fj_names = 'omega_f omega_g'
+    hj_names = 'h_f     h_g'
+    mob_name = L
+    coupled_variables = 'w_c w_o w_co eta_g'
+  []
+  [AC_f_int]
+    type = ACInterface
+    variable = eta_f
+    kappa_name = kappa
+    mob_name = L
+    coupled_variables = 'eta_g'
+  []
+  [eta_f_dot]
+    type = TimeDerivative
+    variable = eta_f
+  []
+
+  #----------------------------------------------------------------------------#
+  # eta_g kernels
+  [AC_g_bulk]
+    type = ACGrGrMulti
+    variable = eta_g
+    v = 'eta_f'
+    gamma_names = 'gamma_fg'
+    mob_name = L
+  []
+  [AC_g_sw]
+    type = ACSwitching
+    variable = eta_g
+    Fj_names = 'omega_f omega_g'
+    hj_names = 'h_f     h_g'
+    mob_name = L
+    coupled_variables = 'w_c w_o w_co eta_f'
+  []
+  [AC_g_int]
+    type = ACInterface
+    variable = eta_g
+    kappa_name = kappa
+    mob_name = L
+    coupled_variables = 'eta_f'
+  []
+  [eta_g_dot]
+    type = TimeDerivative
+    variable = eta_g
+  []
+
+  #----------------------------------------------------------------------------#
+  # Chemical potential kernels
+  [w_c_dot]
+    type = SusceptibilityTimeDerivative
+    variable = w_c
+    f_name = chi_c
+    coupled_variables = 'w_c eta_f eta_g'
+  []
+  [diffusion_c]
+    type = MatDiffusion
+    variable = w_c
+    diffusivity = Dchi_c
+    args = 'w_c eta_f eta_g'
+  []
+  [w_o_dot]
+    type = SusceptibilityTimeDerivative
+    variable = w_o
+    f_name = chi_o
+    coupled_variables = 'w_o eta_f eta_g'
+  []
+  [diffusion_o]
+    type = MatDiffusion
+    variable = w_o
+    diffusivity = Dchi_o
+    args = 'w_o eta_f eta_g'
+  []
+  [w_co_dot]
+    type = SusceptibilityTimeDerivative
+    variable = w_co
+    f_name = chi_co
+    coupled_variables = 'w_co eta_f eta_g'
+  []
+  [diffusion_co]
+    type = MatDiffusion
+    variable = w_co
+    diffusivity = Dchi_co
+    args = 'w_co eta_f eta_g'
+  []
+
+  #----------------------------------------------------------------------------#
+  # Coupled kernels
+  [coupled_eta_f_dot_c]
+    type = CoupledSwitchingTimeDerivative
+    variable = w_c
+    v = eta_f
+    Fj_names = 'rho_c_f  rho_c_g'
+    hj_names = 'h_f      h_g'
+    coupled_variables = 'eta_f eta_g w_o w_co'
+  []
+  [coupled_eta_g_dot_c]
+    type = CoupledSwitchingTimeDerivative
+    variable = w_c
+    v = eta_g
+    Fj_names = 'rho_c_f  rho_c_g'
+    hj_names = 'h_f      h_g'
+    coupled_variables = 'eta_f eta_g w_o w_co'
+  []
+  [coupled_eta_f_dot_o]
+    type = CoupledSwitchingTimeDerivative
+    variable = w_o
+    v = eta_f
+    Fj_names = 'rho_o_f  rho_o_g'
+    hj_names = 'h_f      h_g'
+    coupled_variables = 'eta_f eta_g w_c w_co'
+  []
+  [coupled_eta_g_dot_o]
+    type = CoupledSwitchingTimeDerivative
+    variable = w_o
+    v = eta_g
+    Fj_names = 'rho_o_f  rho_o_g'
+    hj_names = 'h_f      h_g'
+    coupled_variables = 'eta_f eta_g w_c w_co'
+  []
+  [coupled_eta_f_dot_co]
+    type = CoupledSwitchingTimeDerivative
+    variable = w_co
+    v = eta_f
+    Fj_names = 'rho_co_f rho_co_g'
+    hj_names = 'h_f      h_g'
+    coupled_variables = 'eta_f eta_g w_c w_o'
+  []
+  [coupled_eta_g_dot_co]
+    type = CoupledSwitchingTimeDerivative
+    variable = w_co
+    v = eta_g
+    Fj_names = 'rho_co_f rho_co_g'
+    hj_names = 'h_f      h_g'
+    coupled_variables = 'eta_f eta_g w_c w_o'
+  []
+
+  #----------------------------------------------------------------------------#
+  # Heat Conduction kernels
+  [Heat_Conduction]
+    type = Diffusion
+    variable = T
+  []
+  [Heat_Time_Derivative]
+    type = TimeDerivative
+    variable = T
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Materials]
+  #----------------------------------------------------------------------------#
+  # Switching functions
+  [switch_f]
+    type = SwitchingFunctionMultiPhaseMaterial
+    h_name = h_f
+    all_etas = 'eta_f eta_g'
+    phase_etas = 'eta_f'
+  []
+  [switch_g]
+    type = SwitchingFunctionMultiPhaseMaterial
+    h_name = h_g
+    all_etas = 'eta_f eta_g'
+    phase_etas = 'eta_g'
+  []
+
+  #----------------------------------------------------------------------------#
+  # Grand potential densities, densities, susceptibilities and mobilities
+  # (replaces omega_f, omega_g, omega, rho_*, x_*, chi_*, D_* and Dchi_*)
+  [grand_potential]
+    type = GrandPotentialOxidation2PhaseMaterial
+    w = 'w_c w_o w_co'
+    etas = 'eta_f eta_g'
+    h_names = 'h_f h_g'
+
+    phase_names = 'f g'
+    species_names = 'c o co'
+
+    #                    fiber                        gas
+    free_energy_models = 'saturated dilute    dilute     parabolic parabolic parabolic'
+    formation_energies = '1.0       1.5641    1.6179     0         0         0'
+    A                  = '0         0         0          2e-1      1e-6      1e-6'
+    xeq                = '0         0         0          0.0       0.999     0.0'
+    diffusivities      = '1.0       2.8037e+09 2.8037e+09 9.3458e+11 9.3458e+11 9.3458e+11'
+
+    k_b = 2.2096e-05
+    T = 3000
+    Va = 1.0
+  []
+
+  #----------------------------------------------------------------------------#
+  # Reaction rates
+  # (replaces production_CO, reaction_CO, energy_CO and K_CO)
+  [CO_reaction]
+    type = OxidationReactionMaterial
+    rho_a = rho_c
+    rho_b = rho_o
+    temperature = T
+    coupled_variables = 'w_c w_o eta_f eta_g T'
+
+    property_names = 'production_CO reaction_CO energy_CO'
+    coefficients   = '1             -1          -2.6575e-01' # dH = 100 kJ/mol
+
+    K_pre = 6.8191e-01
+    Q = 5.3772e-01
+    k_Boltz = 8.6173e-5
+    int_width = 4644
+    tolerance = 1e-4
+  []
+
+  #----------------------------------------------------------------------------#
+  [phase_mobility]
+    type = GenericConstantMaterial
+    prop_names = 'L'
+    prop_values = '1e3'
+  []
+
+  #----------------------------------------------------------------------------#
+  # Grand Potential Interface Parameters
+  [iface]
+    type = GrandPotentialInterface
+    gamma_names = 'gamma_fg'
+    sigma = '1.4829e-02' # = 0.2 J/m2
+    kappa_name = kappa
+    mu_name = mu
+    sigma_index = 0
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[BCs]
+  [oxygen]
+    type = DirichletBC
+    variable = 'w_o'
+    boundary = 'top'
+    value = '0'
+  []
+  [carbon_monoxide]
+    type = DirichletBC
+    variable = 'w_co'
+    boundary = 'top'
+    value = '0'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Executioner]
+  type = Transient
+
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+
+  nl_max_its = 12
+  nl_rel_tol = 1.0e-8
+  nl_abs_tol = 1e-10
+
+  start_time = 0.0
+  dt = 1
+  num_steps = 2
+
+  scheme = bdf2
+[]
+
+#------------------------------------------------------------------------------#
+[Postprocessors]
+  [total_carbon]
+    type = ElementIntegralMaterialProperty
+    mat_prop = x_c
+  []
+  [total_oxygen]
+    type = ElementIntegralMaterialProperty
+    mat_prop = x_o
+  []
+  [total_mono]
+    type = ElementIntegralMaterialProperty
+    mat_prop = x_co
+  []
+  [total_omega]
+    type = ElementIntegralMaterialProperty
+    mat_prop = omega
+  []
+  [total_production]
+    type = ElementIntegralMaterialProperty
+    mat_prop = production_CO
+  []
+  [total_energy]
+    type = ElementIntegralMaterialProperty
+    mat_prop = energy_CO
+  []
+  [norm_w_o]
+    type = ElementL2Norm
+    variable = w_o
+  []
+  [norm_w_co]
+    type = ElementL2Norm
+    variable = w_co
+  []
+  [norm_eta_f]
+    type = ElementL2Norm
+    variable = eta_f
+  []
+  [average_T]
+    type = ElementAverageValue
+    variable = T
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Outputs]
+  file_base = grand_potential_out
+  [csv]
+    type = CSV
+  []
+[]
@@ -0,0 +1,219 @@
+#------------------------------------------------------------------------------#
+# Compiled Grand Potential Properties
+# The chemical potentials, order parameters and temperature are fixed bilinear
+# fields, and the integrals of the properties computed by the compiled
+# GrandPotentialOxidation2PhaseMaterial and OxidationReactionMaterial are
+# compared with a gold evaluated from the free energies of the step2 inputs
+# at the quadrature points of the 2x2 Gauss rule.
+#------------------------------------------------------------------------------#
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 4
+    ny = 4
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[AuxVariables]
+  [w_c]
+  []
+  [w_o]
+  []
+  [w_co]
+  []
+  [eta_f]
+  []
+  [eta_g]
+  []
+  [T]
+  []
+[]
+
+[ICs]
+  # Bilinear fields are represented exactly by the first order Lagrange basis
+  [IC_w_c]
+    type = FunctionIC
+    variable = w_c
+    function = '0.02*x - 0.01'
+  []
+  [IC_w_o]
+    type = FunctionIC
+    variable = w_o
+    function = '1e-7 - 2e-7*y'
+  []
+  [IC_w_co]
+    type = FunctionIC
+    variable = w_co
+    function = '1e-7*x*y'
+  []
+  [IC_eta_f]
+    type = FunctionIC
+    variable = eta_f
+    function = 'x'
+  []
+  [IC_eta_g]
+    type = FunctionIC
+    variable = eta_g
+    function = '1 - x*y'
+  []
+  [IC_T]
+    type = FunctionIC
+    variable = T
+    function = '3000 + 100*x'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Materials]
+  [switch_f]
+    type = SwitchingFunctionMultiPhaseMaterial
+    h_name = h_f
+    all_etas = 'eta_f eta_g'
+    phase_etas = 'eta_f'
+  []
+  [switch_g]
+    type = SwitchingFunctionMultiPhaseMaterial
+    h_name = h_g
+    all_etas = 'eta_f eta_g'
+    phase_etas = 'eta_g'
+  []
+
+  [grand_potential]
+    type = GrandPotentialOxidation2PhaseMaterial
+    w = 'w_c w_o w_co'
+    etas = 'eta_f eta_g'
+    h_names = 'h_f h_g'
+
+    phase_names = 'f g'
+    species_names = 'c o co'
+
+    #                    fiber                        gas
+    free_energy_models = 'saturated dilute    dilute     parabolic parabolic parabolic'
+    formation_energies = '1.0       1.5641    1.6179     0         0         0'
+    A                  = '0         0         0          2e-1      1e-6      1e-6'
+    xeq                = '0         0         0          0.0       0.999     0.0'
+    diffusivities      = '1.0       2.8037e+09 2.8037e+09 9.3458e+11 9.3458e+11 9.3458e+11'
+
+    k_b = 2.2096e-05
+    T = 3000
+    Va = 1.0
+  []
+
+  [CO_reaction]
+    type = OxidationReactionMaterial
+    rho_a = rho_c
+    rho_b = rho_o
+    temperature = T
+    coupled_variables = 'w_c w_o eta_f eta_g T'
+
+    property_names = 'production_CO reaction_CO energy_CO'
+    coefficients   = '1             -1          -2.6575e-01'
+
+    K_pre = 6.8191e-01
+    Q = 5.3772e-01
+    k_Boltz = 8.6173e-5
+    int_width = 4644
+    tolerance = 1e-4
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Postprocessors]
+  [int_omega]
+    type = ElementIntegralMaterialProperty
+    mat_prop = omega
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_omega_f]
+    type = ElementIntegralMaterialProperty
+    mat_prop = omega_f
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_omega_g]
+    type = ElementIntegralMaterialProperty
+    mat_prop = omega_g
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_x_c]
+    type = ElementIntegralMaterialProperty
+    mat_prop = x_c
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_x_o]
+    type = ElementIntegralMaterialProperty
+    mat_prop = x_o
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_x_co]
+    type = ElementIntegralMaterialProperty
+    mat_prop = x_co
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_chi_c]
+    type = ElementIntegralMaterialProperty
+    mat_prop = chi_c
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_chi_o]
+    type = ElementIntegralMaterialProperty
+    mat_prop = chi_o
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_chi_co]
+    type = ElementIntegralMaterialProperty
+    mat_prop = chi_co
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_Dchi_c]
+    type = ElementIntegralMaterialProperty
+    mat_prop = Dchi_c
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_Dchi_o]
+    type = ElementIntegralMaterialProperty
+    mat_prop = Dchi_o
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_Dchi_co]
+    type = ElementIntegralMaterialProperty
+    mat_prop = Dchi_co
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_production]
+    type = ElementIntegralMaterialProperty
+    mat_prop = production_CO
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_reaction]
+    type = ElementIntegralMaterialProperty
+    mat_prop = reaction_CO
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_energy]
+    type = ElementIntegralMaterialProperty
+    mat_prop = energy_CO
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+
+  [Quadrature]
+    type = GAUSS
+    order = SECOND
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""
+Checks the heavy data of a StaticAwareXDMF output written by static_aware_xdmf.i:
+
+- every data item lies inside its binary file and the items of each file cover it exactly,
+- the topology, geometry and static fields are written once per mesh and shared by all the
+  steps on that mesh, while the time-evolving fields are written every step,
+- the mesh changed at least once (adaptivity) and the static data was written again,
+- the static fields read back from the binary files match the functions that set them.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import xml.etree.ElementTree as ET
+
+STATIC = ('k_xx', 'k_yy')
+
+# Spacing of the initial mesh, the static fields keep the value of the original element
+COARSE_H = 10.0
+
+
+def fail(msg):
+    print('check_xdmf: ' + msg)
+    sys.exit(1)
+
+
+def read_item(item, directory):
+    n = 1
+    for d in item.get('Dimensions').split():
+        n *= int(d)
+    prec = int(item.get('Precision'))
+    fmt = {('Int', 4): 'i', ('Float', 4): 'f', ('Float', 8): 'd'}[(item.get('NumberType'), prec)]
+    path = os.path.join(directory, item.text.strip())
+    seek = int(item.get('Seek'))
+    with open(path, 'rb') as f:
+        f.seek(seek)
+        data = f.read(n * prec)
+    if len(data) != n * prec:
+        fail('%s: item at %d with %d values is outside the file' % (item.text, seek, n))
+    return path, seek, seek + n * prec, struct.unpack('=%d%s' % (n, fmt), data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('xmf')
+    args = parser.parse_args()
+
+    directory = os.path.dirname(os.path.abspath(args.xmf))
+    root = ET.parse(args.xmf).getroot()
+    steps = root.find('Domain').find('Grid').findall('Grid')
+    if not steps:
+        fail('no output steps')
+
+    ranges = {}           # file -> set of (begin, end)
+    meshes = {}           # (file, topology seek) -> seeks of the geometry and static fields
+    evolving = {}         # file -> seeks of the time-evolving fields
+    for step in steps:
+        for grid in step.findall('Grid'):
+            topology = grid.find('Topology')
+            path, topo_seek, end, topo = read_item(topology.find('DataItem'), directory)
+            _, geo_seek, geo_end, xyz = read_item(grid.find('Geometry').find('DataItem'), directory)
+            ranges.setdefault(path, set()).update([(topo_seek, end), (geo_seek, geo_end)])
+
+            # Steps on the same mesh must share the geometry and the static fields
+            key = (path, topo_seek)
+            static_seeks = meshes.setdefault(key, {'geometry': geo_seek})
+            if static_seeks['geometry'] != geo_seek:
+                fail('%s: geometry of the mesh at %d is written again' % (path, topo_seek))
+
+            # Cell centroids from the mixed topology (quadrilaterals only)
+            centroids = []
+            i = 0
+            for _ in range(int(topology.get('NumberOfElements'))):
+                if topo[i] != 5:
+                    fail('%s: unexpected cell type %d' % (path, topo[i]))
+                nodes = topo[i + 1:i + 5]
+                centroids.append((sum(xyz[3 * n] for n in nodes) / 4,
+                                  sum(xyz[3 * n + 1] for n in nodes) / 4))
+                i += 5
+            if i != len(topo):
+                fail('%s: topology size does not match the number of elements' % path)
+
+            for attribute in grid.findall('Attribute'):
+                name = attribute.get('Name')
+                _, seek, end, values = read_item(attribute.find('DataItem'), directory)
+                ranges[path].add((seek, end))
+                if name not in STATIC:
+                    if seek in evolving.get(path, set()):
+                        fail('%s: field %s of step %s reuses the data at %d'
+                             % (path, name, step.get('Name'), seek))
+                    evolving.setdefault(path, set()).add(seek)
+                    continue
+
+                if static_seeks.setdefault(name, seek) != seek:
+                    fail('%s: static field %s is written again on the same mesh' % (path, name))
+                component = STATIC.index(name)
+                for value, centroid in zip(values, centroids):
+                    # The field is set on the initial mesh and inherited by refined children
+                    original = (int(centroid[component] // COARSE_H) + 0.5) * COARSE_H
+                    if abs(100 * value - original) > 1e-4:
+                        fail('%s: %s = %g on the element at (%g, %g)'
+                             % (path, name, value, centroid[0], centroid[1]))
+
+    # The data items of each file must tile it without gaps or overlaps
+    for path, items in ranges.items():
+        pos = 0
+        for begin, end in sorted(items):
+            if begin != pos:
+                fail('%s: gap or overlap at byte %d' % (path, pos))
+            pos = end
+        if pos != os.path.getsize(path):
+            fail('%s: %d bytes referenced but the file has %d' % (path, pos, os.path.getsize(path)))
+
+    files = len(ranges)
+    if len(meshes) <= files:
+        fail('the static data was written only once per process, the mesh never changed')
+
+    print('check_xdmf: %d steps, %d binary files, %d meshes, OK' % (len(steps), files, len(meshes)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,112 @@
+#------------------------------------------------------------------------------#
+# Static-aware XDMF output
+# The conductivity components are set once on initial and written only with
+# the mesh; the order parameter is written every output step in single
+# precision. The mesh is refined during the run, so the static data is
+# written again for the new mesh. check_xdmf.py verifies the layout of the
+# heavy data and the static fields read back from it.
+#------------------------------------------------------------------------------#
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 10
+    ny = 10
+    xmax = 100
+    ymax = 100
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Variables]
+  [eta_f]
+  []
+[]
+
+[AuxVariables]
+  [k_xx]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [k_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[Functions]
+  [ic_func_eta_f]
+    type = ParsedFunction
+    expression = '0.5*(1.0-tanh(2*(sqrt((x-50)^2+(y-50)^2)-25)/4))'
+  []
+[]
+
+[ICs]
+  [IC_eta_f]
+    type = FunctionIC
+    variable = eta_f
+    function = ic_func_eta_f
+  []
+[]
+
+[AuxKernels]
+  [k_xx]
+    type = FunctionAux
+    variable = k_xx
+    function = 'x/100'
+    execute_on = 'INITIAL'
+  []
+  [k_yy]
+    type = FunctionAux
+    variable = k_yy
+    function = 'y/100'
+    execute_on = 'INITIAL'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Kernels]
+  [eta_f_dot]
+    type = TimeDerivative
+    variable = eta_f
+  []
+  [eta_f_diff]
+    type = Diffusion
+    variable = eta_f
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Adaptivity]
+  # Refine within one interface width of the fiber surface and coarsen beyond two
+  marker = band
+  max_h_level = 1
+  [Markers]
+    [band]
+      type = ValueRangeMarker
+      variable = eta_f
+      lower_bound = ${fparse 0.5 * (1 - tanh(2 * 1))}
+      upper_bound = ${fparse 0.5 * (1 + tanh(2 * 1))}
+      buffer_size = ${fparse 0.5 * (tanh(2 * 2) - tanh(2 * 1))}
+      third_state = DO_NOTHING
+    []
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  num_steps = 4
+  dt = 1
+[]
+
+#------------------------------------------------------------------------------#
+[Outputs]
+  [xdmf]
+    type = StaticAwareXDMF
+    static_variables = 'k_xx k_yy'
+    precision = single
+  []
+[]
@@ -0,0 +1,418 @@
+#------------------------------------------------------------------------------#
+# In-process Fiber Orientation
+# Nondimensional parameters with convertion factors:
+# lo = 2.1524e-04 micron
+# to = 4.3299e-04 s
+# eo = 3.9 eV
+# This file computes the direction of a vertical fiber initialized with a
+# bounding box IC without a separate step1 simulation. ArtificialHeatFluxSolve
+# solves the artificial heat conduction problems for x and y with a single
+# operator assembly at initialization and fills the temp_x and temp_y aux
+# variables used by FiberDirectionAF.
+# The same problems are also solved the step1 way, as separate heat conduction
+# solves with Dirichlet conditions on opposite boundaries (Tx_ref, Ty_ref). The
+# fiber directions of both must agree inside the fiber, otherwise the
+# Terminator stops the run with an error.
+#------------------------------------------------------------------------------#
+
+#------------------------------------------------------------------------------#
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+
+    xmin = 0
+    xmax = 557280 # 120 microns
+    nx = 12
+
+    ymin = 0
+    ymax = 557280 # 120 microns
+    ny = 12
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[GlobalParams]
+  # Interface thickness from Grand Potential material
+  width = 4644 # int_width 1 micron, half of the total width
+
+  # [Materials] stuff during initialization
+  derivative_order = 2
+  evalerror_behavior = error
+  enable_ad_cache = false
+  enable_jit = false
+[]
+
+#------------------------------------------------------------------------------#
+[UserObjects]
+  [fiber_orientation]
+    type = ArtificialHeatFluxSolve
+    temp_x = T_x
+    temp_y = T_y
+
+    thermal_conductivity = thermal_conductivity
+    dirichlet_boundary = 'left right bottom top'
+
+    static_materials = 'transformation'
+  []
+
+  # Stops with an error if the directions differ
+  [check_direction]
+    type = Terminator
+    expression = 'max_direction_error > 1e-3'
+    fail_mode = HARD
+    error_level = ERROR
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[ICs]
+  [IC_eta_f]
+    type = BoundingBoxIC
+    variable = eta_f
+    x1 = 232200 # 50
+    y1 = 46440 # 10
+    x2 = 325080 # 70
+    y2 = 510840 # 110
+    inside = 1.0
+    outside = 0.0
+    int_width = 0
+  []
+  [IC_eta_g]
+    type = BoundingBoxIC
+    variable = eta_g
+    x1 = 232200 # 50
+    y1 = 46440 # 10
+    x2 = 325080 # 70
+    y2 = 510840 # 110
+    inside = 0.0
+    outside = 1.0
+    int_width = 0
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Functions]
+  [ic_func_Tx]
+    type = ParsedFunction
+    expression = '(1000-2000)/557280 * x + 2000'
+  []
+  [ic_func_Ty]
+    type = ParsedFunction
+    expression = '(1000-2000)/557280 * y + 2000'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Variables]
+  [T]
+    initial_condition = 3000
+  []
+
+  # Reference artificial temperatures of the separate step1 solves
+  [Tx_ref]
+    [InitialCondition]
+      type = FunctionIC
+      function = ic_func_Tx
+    []
+  []
+  [Ty_ref]
+    [InitialCondition]
+      type = FunctionIC
+      function = ic_func_Ty
+    []
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[AuxVariables]
+  #Phase eta_f: carbon fiber
+  [eta_f]
+  []
+  #Phase eta_g: gas
+  [eta_g]
+  []
+
+  # Artificial temperatures
+  [T_x]
+  []
+  [T_y]
+  []
+
+  # Fiber directions (in-process and reference) and their difference in the fiber
+  [dir_x]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [dir_y]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [ref_x]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [ref_y]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [direction_error]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[AuxKernels]
+  [dir_x]
+    type = MaterialRealVectorValueAux
+    variable = dir_x
+    property = fiber_direction_AF
+    component = 0
+    execute_on = 'TIMESTEP_END'
+  []
+  [dir_y]
+    type = MaterialRealVectorValueAux
+    variable = dir_y
+    property = fiber_direction_AF
+    component = 1
+    execute_on = 'TIMESTEP_END'
+  []
+  [ref_x]
+    type = MaterialRealVectorValueAux
+    variable = ref_x
+    property = fiber_direction_ref
+    component = 0
+    execute_on = 'TIMESTEP_END'
+  []
+  [ref_y]
+    type = MaterialRealVectorValueAux
+    variable = ref_y
+    property = fiber_direction_ref
+    component = 1
+    execute_on = 'TIMESTEP_END'
+  []
+
+  # 1 - |cos| of the angle between the directions, in the fiber away from its ends
+  [direction_error]
+    type = ParsedAux
+    variable = direction_error
+    coupled_variables = 'eta_f dir_x dir_y ref_x ref_y'
+    expression = 'if(eta_f > 0.999 & y > 139320 & y < 417960,
+                     1 - abs(dir_x*ref_x + dir_y*ref_y), 0)'
+    use_xyzt = true
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Kernels]
+  #----------------------------------------------------------------------------#
+  # Heat Conduction kernels
+  [Heat_Conduction]
+    type = MatAnisoDiffusion
+    variable = T
+    args = 'eta_f eta_g'
+
+    diffusivity = thcond_aniso
+  []
+
+  # Separate artificial heat conduction solves of step1
+  [Heat_Conduction_Tx]
+    type = MatDiffusion
+    variable = Tx_ref
+    diffusivity = thermal_conductivity
+  []
+  [Heat_Conduction_Ty]
+    type = MatDiffusion
+    variable = Ty_ref
+    diffusivity = thermal_conductivity
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Materials]
+  #----------------------------------------------------------------------------#
+  # Switching functions
+  [switch_f]
+    type = SwitchingFunctionMultiPhaseMaterial
+    h_name = h_f
+    all_etas = 'eta_f eta_g'
+    phase_etas = 'eta_f'
+  []
+
+  [switch_g]
+    type = SwitchingFunctionMultiPhaseMaterial
+    h_name = h_g
+    all_etas = 'eta_f eta_g'
+    phase_etas = 'eta_g'
+  []
+
+  #------------------------------------------------------------------------------#
+  # Conductivity of the artificial heat conduction problems
+  [thermal_conductivity]
+    type = DerivativeParsedMaterial
+    property_name = thermal_conductivity
+    coupled_variables = 'eta_f eta_g'
+
+    expression = 'h_f*100.0 + h_g*1.0'
+
+    material_property_names = 'h_f(eta_f,eta_g) h_g(eta_f,eta_g)'
+  []
+
+  [th_cond_AF]
+    type = DerivativeParsedMaterial
+    property_name = th_cond_AF
+    coupled_variables = 'eta_f eta_g'
+
+    expression = 'h_f*100 + h_g*0.0'
+
+    material_property_names = 'h_f(eta_f,eta_g) h_g(eta_f,eta_g)'
+  []
+
+  #------------------------------------------------------------------------------#
+  # Tensor Transformation #
+  #------------------------------------------------------------------------------#
+  # FiberDirection transforms the artificial heat flux into the normalized fiber direction
+  [direction_AF]
+    type = FiberDirectionAF
+    temp_x = T_x
+    temp_y = T_y
+
+    thermal_conductivity = th_cond_AF
+    vector_name = fiber_direction_AF
+
+    outputs = exodus
+  []
+
+  [direction_ref]
+    type = FiberDirectionAF
+    temp_x = Tx_ref
+    temp_y = Ty_ref
+
+    thermal_conductivity = th_cond_AF
+    vector_name = fiber_direction_ref
+  []
+
+  # MobilityRotationVector calculates the transformed tensor given the fiber direction
+  [transformation]
+    type = MobilityRotationVector
+    M_A = thcond_f
+    direction_vector = fiber_direction_AF
+    M_name = rot_thcond_f
+    static_tensor = true
+  []
+
+  #----------------------------------------------------------------------------#
+  # Thermal conductivity
+  [thcond_f]
+    type = ConstantAnisotropicMobility
+    tensor = '7.4576e+06      0             0
+              0               7.4576e+04    0
+              0               0             7.4576e+04'
+
+    M_name = thcond_f
+  []
+
+  [thcond_g]
+    type = ConstantAnisotropicMobility
+    tensor = '2.6501e+04      0             0
+              0               2.6501e+04    0
+              0               0             2.6501e+04'
+
+    M_name = thcond_g
+  []
+
+  # Creates a compound tensor for the entire domain
+  [thcond_composite]
+    type = CompositeMobilityTensor
+    coupled_variables = 'eta_f eta_g'
+
+    weights = 'h_f            h_g'
+    tensors = 'rot_thcond_f   thcond_g'
+
+    M_name = thcond_aniso
+
+    outputs = exodus
+    output_properties = thcond_aniso
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[BCs]
+  [fixed_T_top]
+    type = DirichletBC
+    variable = 'T'
+    boundary = 'top'
+    value = '3000'
+  []
+  [fixed_T_bottom]
+    type = DirichletBC
+    variable = 'T'
+    boundary = 'bottom'
+    value = '2988'
+  []
+
+  [Tx_left]
+    type = DirichletBC
+    variable = Tx_ref
+    boundary = 'left'
+    value = 2000
+  []
+  [Tx_right]
+    type = DirichletBC
+    variable = Tx_ref
+    boundary = 'right'
+    value = 1000
+  []
+  [Ty_bottom]
+    type = DirichletBC
+    variable = Ty_ref
+    boundary = 'bottom'
+    value = 2000
+  []
+  [Ty_top]
+    type = DirichletBC
+    variable = Ty_ref
+    boundary = 'top'
+    value = 1000
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Executioner]
+  type = Transient
+
+  nl_rel_tol = 1.0e-8
+  nl_abs_tol = 1e-10
+
+  start_time = 0.0
+  dt = 1
+  num_steps = 1
+
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type  -pc_hypre_type'
+  petsc_options_value = 'hypre     boomeramg'
+[]
+
+#------------------------------------------------------------------------------#
+[Postprocessors]
+  [int_h_f]
+    type = ElementIntegralMaterialProperty
+    mat_prop = h_f
+  []
+  [max_direction_error]
+    type = ElementExtremeValue
+    variable = direction_error
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+
+#------------------------------------------------------------------------------#
+[Outputs]
+  [exodus]
+    type = Exodus
+  []
+[]
@@ -0,0 +1,189 @@
+#------------------------------------------------------------------------------#
+# Fused integrals
+# FusedIntegralUserObject computes the material property and variable integrals
+# of the step2 postprocessor suite in one element loop and one reduction. The
+# fused values are compared with the individual postprocessors, and a
+# Terminator stops the run with an error if they differ. The box is bounded
+# midway between nodes: the nodes x = 0.5..1.2, y = 0.2..0.7 are inside, so the
+# 9 x 7 elements touching them exceed the threshold at a quadrature point
+# (fiber_elements = 63, fiber_volume = 0.63 in the gold).
+#------------------------------------------------------------------------------#
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 20
+    ny = 10
+    xmax = 2
+    ymax = 1
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Variables]
+  [eta_f]
+  []
+  [eta_g]
+  []
+[]
+
+[ICs]
+  [IC_eta_f]
+    type = BoundingBoxIC
+    variable = eta_f
+    x1 = 0.45
+    y1 = 0.15
+    x2 = 1.25
+    y2 = 0.75
+    inside = 1
+    outside = 0
+  []
+  [IC_eta_g]
+    type = BoundingBoxIC
+    variable = eta_g
+    x1 = 0.45
+    y1 = 0.15
+    x2 = 1.25
+    y2 = 0.75
+    inside = 0
+    outside = 1
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Materials]
+  [h_f]
+    type = DerivativeParsedMaterial
+    property_name = h_f
+    coupled_variables = 'eta_f eta_g'
+    expression = 'eta_f^2 / (eta_f^2 + eta_g^2 + 1e-9)'
+    derivative_order = 0
+  []
+  [x_c]
+    type = ParsedMaterial
+    property_name = x_c
+    coupled_variables = 'eta_f'
+    expression = '0.999 * eta_f + 1e-4'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[UserObjects]
+  [fused]
+    type = FusedIntegralUserObject
+    mat_props = 'h_f x_c'
+    variables = 'eta_f eta_g'
+    fiber_variable = eta_f
+    fiber_threshold = 0.1
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [check]
+    type = Terminator
+    expression = 'max_error > 1e-10'
+    fail_mode = HARD
+    error_level = ERROR
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Postprocessors]
+  # Fused values
+  [int_h_f]
+    type = FusedIntegralValue
+    user_object = fused
+    quantity = h_f
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [total_carbon]
+    type = FusedIntegralValue
+    user_object = fused
+    quantity = x_c
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_eta_f]
+    type = FusedIntegralValue
+    user_object = fused
+    quantity = eta_f
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_eta_g]
+    type = FusedIntegralValue
+    user_object = fused
+    quantity = eta_g
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [volume]
+    type = FusedIntegralValue
+    user_object = fused
+    quantity = volume
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [fiber_elements]
+    type = FusedIntegralValue
+    user_object = fused
+    quantity = fiber_elements
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [fiber_volume]
+    type = FusedIntegralValue
+    user_object = fused
+    quantity = fiber_volume
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  # Reference values
+  [ref_h_f]
+    type = ElementIntegralMaterialProperty
+    mat_prop = h_f
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [ref_carbon]
+    type = ElementIntegralMaterialProperty
+    mat_prop = x_c
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [ref_eta_f]
+    type = ElementIntegralVariablePostprocessor
+    variable = eta_f
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [ref_eta_g]
+    type = ElementIntegralVariablePostprocessor
+    variable = eta_g
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [ref_volume]
+    type = VolumePostprocessor
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [max_error]
+    type = ParsedPostprocessor
+    expression = 'max(max(max(abs(int_h_f - ref_h_f), abs(total_carbon - ref_carbon)),
+                          max(abs(int_eta_f - ref_eta_f), abs(int_eta_g - ref_eta_g))),
+                      abs(volume - ref_volume))'
+    pp_names = 'int_h_f ref_h_f total_carbon ref_carbon int_eta_f ref_eta_f int_eta_g ref_eta_g
+                volume ref_volume'
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    file_base = fused_integrals_out
+    show = 'fiber_elements fiber_volume'
+  []
+[]
@@ -0,0 +1,125 @@
+#------------------------------------------------------------------------------#
+# Binary microstructure data
+# An 8 x 8 x 4 woven structure of unit voxels (woven_3d.mcw): warp yarns along x
+# in the two lower layers, weft yarns along y in the two upper ones. It is loaded
+# on a distributed mesh, where every process only builds and maps its slab of
+# voxel layers. The integrals of the phase, feature ids and Euler angles are the
+# sums over the voxels of the file.
+#------------------------------------------------------------------------------#
+
+[Mesh]
+  [mcw_mesh]
+    type = MicrostructureMeshGenerator
+    filename = woven_3d.mcw
+  []
+  parallel_type = DISTRIBUTED
+[]
+
+#------------------------------------------------------------------------------#
+[UserObjects]
+  [mcw]
+    type = MicrostructureReader
+    filename = woven_3d.mcw
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[AuxVariables]
+  [phase]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [feature_id]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [phi1]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [phi]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [phi2]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[ICs]
+  [phase]
+    type = MicrostructureDataIC
+    variable = phase
+    reader = mcw
+    data_name = phase
+  []
+  [feature_id]
+    type = MicrostructureDataIC
+    variable = feature_id
+    reader = mcw
+    data_name = feature_id
+  []
+  [phi1]
+    type = MicrostructureDataIC
+    variable = phi1
+    reader = mcw
+    data_name = phi1
+  []
+  [phi]
+    type = MicrostructureDataIC
+    variable = phi
+    reader = mcw
+    data_name = phi
+  []
+  [phi2]
+    type = MicrostructureDataIC
+    variable = phi2
+    reader = mcw
+    data_name = phi2
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Postprocessors]
+  [int_phase]
+    type = ElementIntegralVariablePostprocessor
+    variable = phase
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_feature_id]
+    type = ElementIntegralVariablePostprocessor
+    variable = feature_id
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_phi1]
+    type = ElementIntegralVariablePostprocessor
+    variable = phi1
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_phi]
+    type = ElementIntegralVariablePostprocessor
+    variable = phi
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [int_phi2]
+    type = ElementIntegralVariablePostprocessor
+    variable = phi2
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Outputs]
+  csv = true
+[]
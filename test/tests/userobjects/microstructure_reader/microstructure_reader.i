@@ -0,0 +1,76 @@
+#------------------------------------------------------------------------------#
+# Binary microstructure loading
+# Two yarns in a 16 x 8 matrix of unit voxels (woven_2d.mcw, converted from
+# woven_2d_ebsd.txt). The mesh is generated from the file header only and each
+# process maps the voxel layers of its partition. The nodal phase fractions
+# conserve the voxel counts, 80 matrix and 48 yarn voxels.
+#------------------------------------------------------------------------------#
+
+[Mesh]
+  [mcw_mesh]
+    type = MicrostructureMeshGenerator
+    filename = woven_2d.mcw
+    pre_refine = 1
+  []
+  parallel_type = DISTRIBUTED
+[]
+
+#------------------------------------------------------------------------------#
+[Variables]
+  [eta_g]
+  []
+  [eta_f]
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[UserObjects]
+  [mcw]
+    type = MicrostructureReader
+    filename = woven_2d.mcw
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[ICs]
+  [IC_eta_g]
+    type = MicrostructurePhaseIC
+    reader = mcw
+    phase = 1
+    variable = eta_g
+  []
+  [IC_eta_f]
+    type = MicrostructurePhaseIC
+    reader = mcw
+    phase = 2
+    variable = eta_f
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Postprocessors]
+  [area_g]
+    type = ElementIntegralVariablePostprocessor
+    variable = eta_g
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [area_f]
+    type = ElementIntegralVariablePostprocessor
+    variable = eta_f
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+#------------------------------------------------------------------------------#
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,45 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "gtest/gtest.h"
+
+#include "MooseTypes.h"
+
+#include <chrono>
+#include <string>
+
+namespace MacawBenchmark
+{
+/// Results are accumulated here so that the timed code is not optimized away
+extern volatile Real sink;
+
+/**
+ * Time repeats calls of f (after a short warm-up) and return the time per call in ns. The
+ * value is recorded as the gtest property <name>_ns, which ends up in the
+ * --gtest_output=json report collected by benchmarks/run_benchmarks.py.
+ */
+template <typename F>
+Real
+timeCall(const std::string & name, unsigned int repeats, F && f)
+{
+  for (unsigned int r = 0; r < repeats / 10 + 1; ++r)
+    f();
+
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned int r = 0; r < repeats; ++r)
+    f();
+  const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+  const Real ns = elapsed.count() / repeats;
+  ::testing::Test::RecordProperty(name + "_ns", std::to_string(ns));
+  return ns;
+}
+}